@@ -18,10 +18,13 @@
 #include "LuxLogChannels.h"
 #include "Tasks/LuxActionTask.h"
 #include "ActionSystem/Cooldown/LuxCooldownTracker.h"
+#include "System/LuxTraceRecorder.h"
 
 // 게임 프레임워크
 #include "Game/LuxPlayerController.h"
 #include "Game/LuxPlayerState.h"
+#include "Character/LuxCharacterMovementComponent.h"
+#include "Input/LuxInputConfig.h"
 
 // 언리얼 엔진 헤더
 #include "Engine/NetConnection.h"
@@ -77,29 +80,28 @@ void UActionSystemComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		ProcessActionInput(DeltaTime, false);
 	}
 
-	ACharacter* AvatarCharacter = Cast<ACharacter>(GetAvatarActor());
-	if (AvatarCharacter && AvatarCharacter->GetCharacterMovement())
+	// 만료 및 주기 시각에 도달한 이펙트를 한 번에 처리합니다.
+	if (!EffectScheduler.IsEmpty())
 	{
-		FContextPayload Payload;
-		FPayload_GameplayEventData EventData;
-		EventData.Instigator = GetAvatarActor();
-		Payload.SetData(LuxPayloadKeys::GameplayEventData, EventData);
+		ProcessScheduledEffects();
+	}
 
-		const bool bNowMoving = AvatarCharacter->GetCharacterMovement()->GetCurrentAcceleration().SizeSquared() > 0.f;
-		if (bNowMoving)
-		{
-			BroadcastGameplayEventToSubscribers(LuxGameplayTags::Event_Movement_Started, Payload);
-		}
+	// 이번 프레임 동안 더티로 표시된 속성들을 한 번씩만 재계산합니다.
+	if (DirtyAttributes.Num() > 0)
+	{
+		FlushDirtyAttributes();
+	}
 
-		// 움직임 상태가 이전 프레임과 달라졌을 때만 이벤트를 발생시킵니다.
-		if (bNowMoving != bIsMoving)
-		{
-			bIsMoving = bNowMoving;
-			if (!bIsMoving)
-			{
-				BroadcastGameplayEventToSubscribers(LuxGameplayTags::Event_Movement_Stopped, Payload);
-			}
-		}
+	// 이번 프레임 동안 누적된 태그 변경을 구독자에게 한 번씩만 전달합니다.
+	if (GrantedTags.HasPendingTagChangeNotifications())
+	{
+		GrantedTags.FlushTagChangeNotifications();
+	}
+
+	ACharacter* AvatarCharacter = Cast<ACharacter>(GetAvatarActor());
+	if (AvatarCharacter && AvatarCharacter->GetCharacterMovement())
+	{
+		UpdateMovementState(*AvatarCharacter->GetCharacterMovement());
 	}
 
 	if (PendingKillActions.Num() > 0)
@@ -149,6 +151,9 @@ void UActionSystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		UActionSystemGlobals::Get().UnregisterComponent(this);
 	}
 
+	// 아직 보내지 않은 서버 요청이 있다면 정리 전에 전송합니다.
+	FlushServerRPCBundle();
+
 	if (GetOwnerRole() == ENetRole::ROLE_Authority)
 	{
 		RemoveAllActions();
@@ -213,6 +218,37 @@ void UActionSystemComponent::InitActorInfo(AActor* NewOwnerActor, AActor* NewAva
 			AddAttributeSet(FoundAttribute);
 		}
 	}
+
+	BindMovementModifierState();
+}
+
+void UActionSystemComponent::BindMovementModifierState()
+{
+	ACharacter* AvatarCharacter = Cast<ACharacter>(GetAvatarActor());
+	LuxMovementComponent = AvatarCharacter ? Cast<ULuxCharacterMovementComponent>(AvatarCharacter->GetCharacterMovement()) : nullptr;
+
+	// 아바타가 바뀌었을 수 있으므로 버전과 관계없이 현재 상태를 한 번 전달합니다.
+	if (ULuxCharacterMovementComponent* LuxMoveComp = LuxMovementComponent.Get())
+	{
+		MovementBlockTagsVersion = GrantedTags.GetTagsVersion();
+		LuxMoveComp->SetMovementBlocked(GrantedTags.ContainsTag(LuxGameplayTags::State_Block_Movement));
+	}
+}
+
+void UActionSystemComponent::RefreshMovementBlocked()
+{
+	// 보유 태그 집합이 그대로라면 차단 여부도 그대로이므로 건너뜁니다.
+	const uint32 TagsVersion = GrantedTags.GetTagsVersion();
+	if (TagsVersion == MovementBlockTagsVersion)
+	{
+		return;
+	}
+	MovementBlockTagsVersion = TagsVersion;
+
+	if (ULuxCharacterMovementComponent* LuxMoveComp = LuxMovementComponent.Get())
+	{
+		LuxMoveComp->SetMovementBlocked(GrantedTags.ContainsTag(LuxGameplayTags::State_Block_Movement));
+	}
 }
 
 void UActionSystemComponent::SetOwnerActor(AActor* NewOwnerActor)
@@ -282,7 +318,7 @@ FLuxActionSpecHandle UActionSystemComponent::K2_GrantAction(TSubclassOf<ULuxActi
 	{
 		FRWScopeLock WriteLock(ActionSpecsLock, FRWScopeLockType::SLT_Write);
 		FLuxActionSpec& NewSpec = LuxActionSpecs.Items.Add_GetRef(FLuxActionSpec(ActionClass, InputTag, Level));
-		//ActionSpecMap.Add(NewSpec.Handle, &NewSpec);
+		LuxActionSpecs.HandleIndex.Add(NewSpec.Handle.Handle, LuxActionSpecs.Items.Num() - 1);
 		LuxActionSpecs.MarkArrayDirty();
 
 		if (ActionCDO->InstancingPolicy == ELuxActionInstancingPolicy::InstancedPerActor)
@@ -312,6 +348,8 @@ FLuxActionSpecHandle UActionSystemComponent::K2_GrantAction(TSubclassOf<ULuxActi
 		LuxActionSpecs.MarkItemDirty(NewSpec);
 		NewHandle = NewSpec.Handle;
 	}
+
+	PublishActionSpecSnapshot();
 	// === 쓰기 락(Write Lock) 범위 종료 ===
 
 	if (bShouldActivateOnGrant)
@@ -364,7 +402,7 @@ FLuxActionSpecHandle UActionSystemComponent::GrantAction(FLuxActionSpec& InSpec)
 
 		// 완성된 Spec을 컨테이너에 추가합니다.
 		FLuxActionSpec& NewSpec = LuxActionSpecs.Items.Add_GetRef(InSpec);
-		//ActionSpecMap.Add(NewSpec.Handle, &NewSpec);
+		LuxActionSpecs.HandleIndex.Add(NewSpec.Handle.Handle, LuxActionSpecs.Items.Num() - 1);
 		LuxActionSpecs.MarkArrayDirty();
 
 		if (ActionCDO->InstancingPolicy == ELuxActionInstancingPolicy::InstancedPerActor)
@@ -394,6 +432,8 @@ FLuxActionSpecHandle UActionSystemComponent::GrantAction(FLuxActionSpec& InSpec)
 		NewHandle = NewSpec.Handle;
 	}
 
+	PublishActionSpecSnapshot();
+
 	// 락이 해제된 후에 안전하게 액션 활성화를 시도합니다.
 	if (bShouldActivateOnGrant)
 	{
@@ -411,10 +451,12 @@ void UActionSystemComponent::RemoveAction(FLuxActionSpecHandle Handle)
 		return;
 	}
 
-	// 배열에서 제거할 Spec의 인덱스를 직접 찾습니다.
-	const int32 SpecIndex = LuxActionSpecs.Items.IndexOfByPredicate([&Handle](const FLuxActionSpec& Spec) {
-		return Spec.Handle == Handle;
-		});
+	// 색인에서 제거할 Spec의 인덱스를 찾습니다.
+	int32 SpecIndex = INDEX_NONE;
+	{
+		FRWScopeLock ReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
+		SpecIndex = LuxActionSpecs.HandleIndex.Find(Handle.Handle);
+	}
 
 	// 제거할 액션이 없으면 여기서 안전하게 종료됩니다.
 	if (SpecIndex == INDEX_NONE)
@@ -472,8 +514,21 @@ void UActionSystemComponent::RemoveAction(FLuxActionSpecHandle Handle)
 	}
 
 	// 마지막으로 메인 배열에서 Spec을 제거합니다.
-	LuxActionSpecs.Items.RemoveAt(SpecIndex);
-	LuxActionSpecs.MarkArrayDirty();
+	// 액션 종료 콜백 도중 배열이 변경되었을 수 있으므로 인덱스를 다시 조회합니다.
+	{
+		FRWScopeLock WriteLock(ActionSpecsLock, FRWScopeLockType::SLT_Write);
+		SpecIndex = LuxActionSpecs.HandleIndex.Find(Handle.Handle);
+		if (SpecIndex != INDEX_NONE)
+		{
+			LuxActionSpecs.Items.RemoveAtSwap(SpecIndex);
+			LuxActionSpecs.HandleIndex.RemoveAtSwap(SpecIndex);
+			LuxActionSpecs.MarkArrayDirty();
+		}
+	}
+
+	ActivationVerdicts.Remove(Handle);
+
+	PublishActionSpecSnapshot();
 }
 
 void UActionSystemComponent::RemoveAllActions()
@@ -525,7 +580,9 @@ void UActionSystemComponent::RemoveAllActions()
 		}
 
 		LuxActionSpecs.Items.Empty();
+		LuxActionSpecs.HandleIndex.Reset();
 		LuxActionSpecs.MarkArrayDirty();
+		ActivationVerdicts.Reset();
 
 		// 이 Spec들을 참조하던 입력 핸들도 비웁니다.
 		{
@@ -535,6 +592,8 @@ void UActionSystemComponent::RemoveAllActions()
 			InputHeldSpecHandles.Empty();
 		}
 	}
+
+	PublishActionSpecSnapshot();
 }
 
 // ======================================== Action Activation & Execution ========================================
@@ -611,7 +670,7 @@ void UActionSystemComponent::TryExecuteAction(FLuxActionSpecHandle Handle)
 	);
 
 	// 서버에 Handle과 예측 키를 담아 실행을 요청합니다.
-	Server_TryExecuteAction(Handle, PredictionKey);
+	SendTryExecuteActionToServer(Handle, PredictionKey);
 
 	PredictedInstance->ExecuteAction(ActorInfo, *FoundSpec, TempActiveAction.Handle);
 }
@@ -756,6 +815,7 @@ void UActionSystemComponent::ReHomePredictedActionTasks(FActiveLuxAction& Author
 
 	AuthoritativeActionPtr->OwningActorInfo = AuthoritativeAction.ActorInfo;
 	AuthoritativeActionPtr->ActiveActionHandle = AuthoritativeAction.Handle;
+	AuthoritativeActionPtr->ActiveSpecHandle = AuthoritativeAction.Spec.Handle;
 
 	// 인스턴싱 정책에 따라 분기합니다.
 	const ELuxActionInstancingPolicy InstancingPolicy = AuthoritativeActionPtr->GetInstancingPolicy();
@@ -978,6 +1038,7 @@ void UActionSystemComponent::OnActionEnd(const FActiveLuxActionHandle& Handle, b
 	{
 		ActionInstance->LifecycleState = ELuxActionLifecycleState::Inactive;
 		ActionInstance->ActiveActionHandle = FActiveLuxActionHandle();
+		ActionInstance->ActiveSpecHandle = FLuxActionSpecHandle();
 	}
 
 	FLuxActionSpec* Spec = FindActionSpecFromHandle(ActiveLuxAction.Spec.Handle);
@@ -1006,6 +1067,11 @@ void UActionSystemComponent::OnActionEnd(const FActiveLuxActionHandle& Handle, b
 
 // ======================================== Action Activation Checks ========================================
 
+bool UActionSystemComponent::GetActivationVerdict(FLuxActionSpecHandle Handle, FGameplayTagContainer& OutFailureTags) const
+{
+	return CanActivateAction(Handle, OutFailureTags);
+}
+
 bool UActionSystemComponent::CanActivateAction(FLuxActionSpecHandle Handle, FGameplayTagContainer& OutFailureTags) const
 {
 	const FLuxActionSpec* Spec = FindActionSpecFromHandle(Handle);
@@ -1014,28 +1080,79 @@ bool UActionSystemComponent::CanActivateAction(FLuxActionSpecHandle Handle, FGam
 		return false;
 	}
 
-	const ULuxAction* Action = Spec->Action;
+	// 추가 비용은 아이템 개수 등 이 컴포넌트가 추적하지 않는 상태를 읽으므로 매번 평가합니다.
+	if (Spec->Action->AdditionalCosts.Num() > 0)
+	{
+		return EvaluateActivationRequirements(*Spec, OutFailureTags);
+	}
+
+	// 쿨다운과 충전 스택은 태그로 표현되므로 태그 버전에 포함됩니다.
+	const uint32 TagsVersion = GrantedTags.GetTagsVersion();
+	const uint32 CostAttributesVersion = GetCostAttributesVersion(*Spec->Action);
+
+	if (const FLuxActivationVerdict* Cached = ActivationVerdicts.Find(Handle))
+	{
+		if (Cached->TagsVersion == TagsVersion && Cached->CostAttributesVersion == CostAttributesVersion && Cached->Level == Spec->Level)
+		{
+			OutFailureTags.AppendTags(Cached->FailureTags);
+			return Cached->bCanActivate;
+		}
+	}
+
+	FLuxActivationVerdict& Verdict = ActivationVerdicts.FindOrAdd(Handle);
+	Verdict.TagsVersion = TagsVersion;
+	Verdict.CostAttributesVersion = CostAttributesVersion;
+	Verdict.Level = Spec->Level;
+	Verdict.FailureTags.Reset();
+	Verdict.bCanActivate = EvaluateActivationRequirements(*Spec, Verdict.FailureTags);
+
+	OutFailureTags.AppendTags(Verdict.FailureTags);
+	return Verdict.bCanActivate;
+}
+
+uint32 UActionSystemComponent::GetCostAttributesVersion(const ULuxAction& Action) const
+{
+	uint32 Version = 0;
+
+	if (Action.Cost)
+	{
+		if (const ULuxEffect* CostEffectCDO = Action.Cost->GetDefaultObject<ULuxEffect>())
+		{
+			// 버전은 단조 증가하므로 합이 같다면 어떤 비용 속성도 바뀌지 않은 것입니다.
+			for (const FAttributeModifier& Mod : CostEffectCDO->Modifiers)
+			{
+				Version += GetAttributeVersion(Mod.Attribute);
+			}
+		}
+	}
+
+	return Version;
+}
+
+bool UActionSystemComponent::EvaluateActivationRequirements(const FLuxActionSpec& Spec, FGameplayTagContainer& OutFailureTags) const
+{
+	const ULuxAction* Action = Spec.Action;
 
 	// 1. 차단 태그 체크
-	if (HasBlockedTags(*Spec, Action->ActivationBlockedTags, OutFailureTags))
+	if (HasBlockedTags(Spec, Action->GetActivationBlockedQuery(), OutFailureTags))
 	{
 		return false;
 	}
 
 	// 2. 필수 태그 체크
-	if (!HasRequiredTags(*Spec, Action->ActivationRequiredTags, OutFailureTags))
+	if (!HasRequiredTags(Spec, Action->GetActivationRequiredQuery(), OutFailureTags))
 	{
 		return false;
 	}
 
 	// 3. 비용 체크
-	if (!CheckCost(*Spec, OutFailureTags))
+	if (!CheckCost(Spec, OutFailureTags))
 	{
 		return false;
 	}
 
 	// 4. 쿨다운 체크
-	if (!CheckCooldown(*Spec, OutFailureTags))
+	if (!CheckCooldown(Spec, OutFailureTags))
 	{
 		return false;
 	}
@@ -1112,7 +1229,7 @@ bool UActionSystemComponent::CheckCost(const FLuxActionSpec& Spec, FGameplayTagC
 	return true;
 }
 
-bool UActionSystemComponent::HasBlockedTags(const FLuxActionSpec& Spec, const FGameplayTagContainer& ActivationBlockedTags, FGameplayTagContainer& OutFailureTags) const
+bool UActionSystemComponent::HasBlockedTags(const FLuxActionSpec& Spec, const FLuxCompiledTagQuery& ActivationBlockedQuery, FGameplayTagContainer& OutFailureTags) const
 {
 	// 액션 고유 태그가 있으면 차단됩니다. 
 	// 액션의 중복 실행을 방지하기 위해 사용됩니다.
@@ -1122,60 +1239,46 @@ bool UActionSystemComponent::HasBlockedTags(const FLuxActionSpec& Spec, const FG
 		return true;
 	}
 
-	// ActivationBlockedTags에 있는 태그 중 하나라도 GrantedTags에 존재하면 차단됩니다.
-	for (const FGameplayTag& Tag : ActivationBlockedTags)
+	// ActivationBlockedTags에 있는 태그 중 하나라도 GrantedTags에 존재하면 차단됩니다. (RequireNone 질의)
+	if (!GrantedTags.MatchesQuery(ActivationBlockedQuery))
 	{
-		if (GrantedTags.ContainsTag(Tag))
-		{
-			OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsBlocked);
-			return true;
-		}
+		OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsBlocked);
+		return true;
 	}
 
 	// 관계 매핑을 통한 차단 태그를 확인합니다.
 	if (TagRelationshipMapping)
 	{
-		FGameplayTagContainer MappedBlockedTags;
-		TagRelationshipMapping->GetBlockedActivationTags(Spec.Action->ActionTags, MappedBlockedTags);
+		const FLuxCompiledTagQuery& MappedBlockedQuery = TagRelationshipMapping->GetRelationshipsForTags(Spec.Action->ActionTags).ActivationBlockedQuery;
 
-		for (const FGameplayTag& Tag : MappedBlockedTags)
+		if (!GrantedTags.MatchesQuery(MappedBlockedQuery))
 		{
-			if (GrantedTags.ContainsTag(Tag))
-			{
-				OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsBlocked);
-				return true;
-			}
+			OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsBlocked);
+			return true;
 		}
 	}
 
 	return false;
 }
 
-bool UActionSystemComponent::HasRequiredTags(const FLuxActionSpec& Spec, const FGameplayTagContainer& ActivationRequiredTags, FGameplayTagContainer& OutFailureTags) const
+bool UActionSystemComponent::HasRequiredTags(const FLuxActionSpec& Spec, const FLuxCompiledTagQuery& ActivationRequiredQuery, FGameplayTagContainer& OutFailureTags) const
 {
-	// ActivationRequiredTags에 있는 모든 태그가 GrantedTags에 존재해야 합니다.
-	for (const FGameplayTag& Tag : ActivationRequiredTags)
+	// ActivationRequiredTags에 있는 모든 태그가 GrantedTags에 존재해야 합니다. (RequireAll 질의)
+	if (!GrantedTags.MatchesQuery(ActivationRequiredQuery))
 	{
-		if (!GrantedTags.ContainsTag(Tag))
-		{
-			OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsMissing);
-			return false;
-		}
+		OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsMissing);
+		return false;
 	}
 
 	// 관계 매핑을 통한 필수 태그를 확인합니다.
 	if (TagRelationshipMapping)
 	{
-		FGameplayTagContainer MappedRequiredTags;
-		TagRelationshipMapping->GetRequiredActivationTags(Spec.Action->ActionTags, MappedRequiredTags);
+		const FLuxCompiledTagQuery& MappedRequiredQuery = TagRelationshipMapping->GetRelationshipsForTags(Spec.Action->ActionTags).ActivationRequiredQuery;
 
-		for (const FGameplayTag& Tag : MappedRequiredTags)
+		if (!GrantedTags.MatchesQuery(MappedRequiredQuery))
 		{
-			if (!GrantedTags.ContainsTag(Tag))
-			{
-				OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsMissing);
-				return false;
-			}
+			OutFailureTags.AddTag(LuxGameplayTags::Action_Fail_TagsMissing);
+			return false;
 		}
 	}
 
@@ -1238,6 +1341,7 @@ void UActionSystemComponent::Client_NotifyActionEnded_Implementation(FActiveLuxA
 	{
 		ActionInstance->LifecycleState = ELuxActionLifecycleState::Inactive;
 		ActionInstance->ActiveActionHandle = FActiveLuxActionHandle();
+		ActionInstance->ActiveSpecHandle = FLuxActionSpecHandle();
 	}
 
 	UE_LOG(LogLuxActionSystem, Error, TEXT("================>>> [CLIENT] Action Ended: %s | Owner: %s | InstancingPolicy: %s | PredictionKey: %d ---"),
@@ -1329,32 +1433,7 @@ FLuxActionSpec* UActionSystemComponent::FindActionSpecFromHandle(FLuxActionSpecH
 		return nullptr;
 	}
 
-
-	// 빠른 조회를 위해 Map 에서 검색합니다.
-	/*{
-		FRWScopeLock ReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
-		FLuxActionSpec** FoundSpecPtr = ActionSpecMap.Find(ActionHandle);
-		if (FoundSpecPtr || *FoundSpecPtr)
-		{
-			return *FoundSpecPtr;
-		}
-	}*/
-
-	// 맵에 없다면 (리플리케이션 지연 등) 원본 배열에서 검색합니다.
-	{
-		FRWScopeLock WriteLock(ActionSpecsLock, FRWScopeLockType::SLT_Write);
-		for (FLuxActionSpec& Spec : LuxActionSpecs.Items)
-		{
-			if (Spec.Handle == ActionHandle)
-			{
-				//ActionSpecMap.Add(ActionHandle, &Spec);
-				return &Spec;
-			}
-		}
-	}
-
-	// 맵과 배열 어디에도 없다면 null을 반환합니다.
-	return nullptr;
+	return const_cast<FLuxActionSpec*>(static_cast<const UActionSystemComponent*>(this)->FindActionSpecFromHandle(ActionHandle));
 }
 
 const FLuxActionSpec* UActionSystemComponent::FindActionSpecFromHandle(FLuxActionSpecHandle ActionHandle) const
@@ -1364,18 +1443,24 @@ const FLuxActionSpec* UActionSystemComponent::FindActionSpecFromHandle(FLuxActio
 		return nullptr;
 	}
 
-	/*FRWScopeLock ReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
-	FLuxActionSpec* const* FoundSpecPtr = ActionSpecMap.Find(ActionHandle);
-	if (FoundSpecPtr || *FoundSpecPtr)
+	FRWScopeLock ReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
+
+	// 빠른 조회를 위해 색인에서 검색합니다.
+	const int32 SpecIndex = LuxActionSpecs.HandleIndex.Find(ActionHandle.Handle);
+	if (LuxActionSpecs.Items.IsValidIndex(SpecIndex) && LuxActionSpecs.Items[SpecIndex].Handle == ActionHandle)
 	{
-		return *FoundSpecPtr;
-	}*/
+		return &LuxActionSpecs.Items[SpecIndex];
+	}
 
-	for (const FLuxActionSpec& Spec : LuxActionSpecs.Items)
+	// 색인이 아직 갱신되지 않았다면 (리플리케이션 수신 도중 등) 원본 배열에서 검색합니다.
+	if (LuxActionSpecs.HandleIndex.IsDirty())
 	{
-		if (Spec.Handle == ActionHandle)
+		for (const FLuxActionSpec& Spec : LuxActionSpecs.Items)
 		{
-			return &Spec;
+			if (Spec.Handle == ActionHandle)
+			{
+				return &Spec;
+			}
 		}
 	}
 
@@ -1479,6 +1564,40 @@ const TArray<FActiveLuxAction>& UActionSystemComponent::GetActiveActions() const
 	return ActiveLuxActions.Items;
 }
 
+FLuxActionSpecSnapshotPtr UActionSystemComponent::GetActionSpecSnapshot() const
+{
+	// 포인터 복사(참조 카운트 증가)만 보호하며, 스냅샷 자체는 락 없이 읽습니다.
+	FRWScopeLock ReadLock(ActionSpecSnapshotLock, FRWScopeLockType::SLT_ReadOnly);
+	return ActionSpecSnapshot;
+}
+
+void UActionSystemComponent::PublishActionSpecSnapshot()
+{
+	TSharedPtr<FLuxActionSpecSnapshot, ESPMode::ThreadSafe> NewSnapshot = MakeShared<FLuxActionSpecSnapshot, ESPMode::ThreadSafe>();
+	{
+		FRWScopeLock ReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
+		NewSnapshot->Specs.Reserve(LuxActionSpecs.Items.Num());
+		for (const FLuxActionSpec& Spec : LuxActionSpecs.Items)
+		{
+			NewSnapshot->Specs.Emplace(Spec);
+		}
+	}
+
+	NewSnapshot->HandleIndex.Rebuild(NewSnapshot->Specs, [](const FLuxActionSpecSnapshotEntry& Entry) { return Entry.Handle.Handle; });
+
+	FRWScopeLock WriteLock(ActionSpecSnapshotLock, FRWScopeLockType::SLT_Write);
+
+	// Spec 구성이나 입력 태그가 바뀐 경우에만 다음 입력 때 라우팅 테이블을 다시 채웁니다.
+	// 입력 처리 도중 Spec 이 부여될 수 있으므로 InputHandlesLock 을 잡지 않고 표시만 합니다.
+	if (!ActionSpecSnapshot.IsValid() || !ActionSpecSnapshot->HasSameInputRouting(*NewSnapshot))
+	{
+		bInputRoutesDirty = true;
+	}
+
+	NewSnapshot->Version = ActionSpecSnapshot.IsValid() ? ActionSpecSnapshot->Version + 1 : 1;
+	ActionSpecSnapshot = NewSnapshot;
+}
+
 FLuxActionSpec* UActionSystemComponent::FindActionSpecByIdentifierTag(const FGameplayTag& IdentifierTag)
 {
 	if (!IdentifierTag.IsValid())
@@ -1589,12 +1708,57 @@ bool UActionSystemComponent::ApplyEffectSpecToTarget(const FLuxEffectSpecHandle&
 	// 서버에서만 실제 적용 로직을 실행합니다.
 	if (OwnerActor.IsValid() && OwnerActor->HasAuthority())
 	{
-		return TargetASC->ApplyEffectSpec_Internal(*SpecHandle.Get(), OutActiveHandle);
+		return TargetASC->ApplyEffectSpec_Internal(*SpecHandle.Get(), OutActiveHandle, ELuxSpecPrepareStage::All);
 	}
 
 	return false;
 }
 
+int32 UActionSystemComponent::ApplyEffectSpecToTargets(const FLuxEffectSpecHandle& SpecHandle, const TArray<UActionSystemComponent*>& Targets, TArray<FLuxEffectTargetResult>& OutResults)
+{
+	OutResults.Reset(Targets.Num());
+
+	// 서버에서만 실제 적용 로직을 실행합니다.
+	if (!SpecHandle.IsValid() || !SpecHandle.Get()->IsValid() || !OwnerActor.IsValid() || !OwnerActor->HasAuthority())
+	{
+		return 0;
+	}
+
+	// 대상과 무관한 Execution 은 원본을 복사한 Spec 에서 한 번만 실행합니다.
+	FLuxEffectSpec PreparedSpec(*SpecHandle.Get());
+	if (!PrepareSpecForApplication(PreparedSpec, ELuxSpecPrepareStage::SourceOnly))
+	{
+		return 0;
+	}
+
+	int32 NumApplied = 0;
+	for (UActionSystemComponent* TargetASC : Targets)
+	{
+		FLuxEffectTargetResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.TargetASC = TargetASC;
+
+		if (!::IsValid(TargetASC))
+		{
+			continue;
+		}
+
+		// 대상 의존 Execution 이 서로의 결과를 덮어쓰지 않도록 대상마다 Spec 과 컨텍스트를 분리합니다.
+		// 분리한 Spec 은 결과에 담아 호출자가 대상별 계산 결과(피해량, 치명타 등)를 읽을 수 있게 합니다.
+		FLuxEffectSpec* TargetSpec = new FLuxEffectSpec(PreparedSpec);
+		Result.AppliedSpec = FLuxEffectSpecHandle(TargetSpec);
+		TargetSpec->ContextHandle = PreparedSpec.ContextHandle.Duplicate();
+		TargetSpec->ContextHandle.SetTargetASC(TargetASC);
+
+		Result.bApplied = TargetASC->ApplyEffectSpec_Internal(*TargetSpec, Result.ActiveHandle, ELuxSpecPrepareStage::TargetOnly);
+		if (Result.bApplied)
+		{
+			++NumApplied;
+		}
+	}
+
+	return NumApplied;
+}
+
 void UActionSystemComponent::RemoveEffect(FActiveLuxEffectHandle Handle)
 {
 	if (!OwnerActor.IsValid() || !OwnerActor->HasAuthority())
@@ -1619,9 +1783,11 @@ void UActionSystemComponent::RemoveAllActiveEffects()
 	}
 
 	ActiveLuxEffects.Items.Empty();
+	ActiveLuxEffects.HandleIndex.Reset();
+	AttributeAggregators.Empty();
 }
 
-bool UActionSystemComponent::ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FActiveLuxEffectHandle& OutActiveHandle)
+bool UActionSystemComponent::ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FActiveLuxEffectHandle& OutActiveHandle, ELuxSpecPrepareStage PrepareStage)
 {
 	if (!Spec.IsValid())
 	{
@@ -1643,14 +1809,17 @@ bool UActionSystemComponent::ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FAct
         return false;
 	}
 
-	if (HasAny(Template->ApplicationBlockedTags))
+	// 필수/차단 조건을 한 번의 질의로 검사하고, 실패한 경우에만 어떤 조건 때문인지 구분합니다.
+	const bool bApplicationTagsMatched = MatchesTagQuery(Template->GetApplicationTagQuery());
+
+	if (!bApplicationTagsMatched && HasAny(Template->ApplicationBlockedTags))
 	{
         UE_LOG(LogLuxActionSystem, Log, TEXT("[%s][%s] [CheckPrerequisites] 적용 차단 태그(%s)가 있어 이펙트 '%s' 적용에 실패했습니다."), 
             *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__), *Template->ApplicationBlockedTags.ToString(), *GetNameSafe(Template));
         return false;
 	}
 
-	if (HasAll(Template->ApplicationRequiredTags) == false)
+	if (!bApplicationTagsMatched)
 	{
         UE_LOG(LogLuxActionSystem, Log, TEXT("[%s][%s] [CheckPrerequisites] 적용 필수 태그(%s)가 없어 이펙트 '%s' 적용에 실패했습니다."), 
             *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__), *Template->ApplicationRequiredTags.ToString(), *GetNameSafe(Template));
@@ -1658,7 +1827,7 @@ bool UActionSystemComponent::ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FAct
 	}
 
 	// [2단계] 계산 실행 (기본 검증 통과 후에만 데미지 계산)
-    if (!PrepareSpecForApplication(Spec))
+    if (!PrepareSpecForApplication(Spec, PrepareStage))
     {
         return false; // 계산 실패
     }
@@ -1686,13 +1855,19 @@ bool UActionSystemComponent::ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FAct
     return true;
 }
 
-bool UActionSystemComponent::PrepareSpecForApplication(FLuxEffectSpec& Spec)
+bool UActionSystemComponent::PrepareSpecForApplication(FLuxEffectSpec& Spec, ELuxSpecPrepareStage PrepareStage)
 {
 	const ULuxEffect* Template = Spec.EffectTemplate.Get();
 	if (!Template) return false;
 
 	UE_LOG(LogLuxActionSystem, Log, TEXT(">> [PrepareSpec] 이펙트 '%s'의 적용 전 계산을 시작합니다."), *GetNameSafe(Template));
 
+	// 대상 단계만 소스 단계 결과를 이어받습니다. 그 외에는 이전 적용에서 남은 표시를 지웁니다.
+	if (PrepareStage != ELuxSpecPrepareStage::TargetOnly)
+	{
+		Spec.bSourceStagePrepared = false;
+	}
+
 	// ExecutionCalculation을 실행하여 OutSpec.CalculatedModifiers를 최종 값으로 채웁니다.
 	if (Template->Executions.Num() > 0)
 	{
@@ -1706,12 +1881,28 @@ bool UActionSystemComponent::PrepareSpecForApplication(FLuxEffectSpec& Spec)
 
 			if (ULuxExecutionCalculation* ExecCDO = ExecClass->GetDefaultObject<ULuxExecutionCalculation>())
 			{
+				// 다중 대상 적용 시 대상 무관 Execution 은 소스 단계에서 한 번만 실행됩니다.
+				const bool bTargetIndependent = ExecCDO->IsTargetIndependent();
+				if (PrepareStage == ELuxSpecPrepareStage::SourceOnly && !bTargetIndependent)
+				{
+					// 대상 의존 Execution 도 대상을 읽지 않는 앞부분은 소스 단계에서 미리 계산해 둡니다.
+					ExecCDO->ExecuteTargetIndependentPart(Spec);
+					continue;
+				}
+
+				if (PrepareStage == ELuxSpecPrepareStage::TargetOnly && bTargetIndependent)
+				{
+					continue;
+				}
+
 				UE_LOG(LogLuxActionSystem, Log, TEXT("  -> Execution 로직 '%s'을(를) 실행합니다."), *ExecCDO->GetName());
 				ExecCDO->Execute(Spec);
 			}
 		}
 	}
 
+	// 소스 단계 결과는 이 Spec 을 복사한 대상별 Spec 에서 한 번만 사용되도록, 대상 단계가 끝나면 표시를 지웁니다.
+	Spec.bSourceStagePrepared = (PrepareStage == ELuxSpecPrepareStage::SourceOnly);
 	return true;
 }
 
@@ -1785,12 +1976,19 @@ void UActionSystemComponent::ApplyModifiers(const FLuxEffectSpec& Spec)
 	const ULuxEffect* Template = Spec.EffectTemplate.Get();
 	if (!Template) return;
 
-	UE_LOG(LogLuxActionSystem, Log, TEXT(">> [ApplyModifiers] 이펙트 '%s'의 Modifier 적용을 시작합니다."), *GetNameSafe(Template));
+	// 이펙트마다 호출되므로 어떤 이펙트가 누구에게서 누구에게 적용되었는지는 트레이스에만 남깁니다.
+	ULuxTraceRecorder* Trace = ULuxTraceRecorder::Get(this);
+	if (Trace)
+	{
+		const UActionSystemComponent* SourceASC = Spec.ContextHandle.IsValid() ? Spec.ContextHandle.GetSourceASC() : nullptr;
+		Trace->Record(ELuxTraceEvent::ApplyModifiers,
+			Trace->GetObjectId(GetAvatarActor()), Trace->GetObjectId(SourceASC ? SourceASC->GetAvatarActor() : nullptr), static_cast<uint16>(Template->DurationPolicy),
+			Template->EffectTags.First(), FGameplayTag(), Spec.Level);
+	}
 
 	// Instant(즉시) 효과는 BaseValue를 직접 변경합니다.
 	if (Template->DurationPolicy == ELuxEffectDurationPolicy::Instant)
 	{
-		UE_LOG(LogLuxActionSystem, Log, TEXT("  -> 즉시(Instant) 효과로 처리합니다. BaseValue를 직접 변경합니다."));
 
 		for (const FAttributeModifier& Mod : Spec.CalculatedModifiers)
 		{
@@ -1815,9 +2013,11 @@ void UActionSystemComponent::ApplyModifiers(const FLuxEffectSpec& Spec)
 			case EModifierOperation::Override: NewBaseValue = Mod.Magnitude.StaticValue;  break;
 			}
 
-			UE_LOG(LogLuxActionSystem, Log, TEXT("      -> 적용: '%s', BaseValue: %.2f -> %.2f (연산: %s, 값: %.2f)"),
-				*Mod.Attribute.GetName().ToString(), CurrentBaseValue, NewBaseValue,
-				*UEnum::GetValueAsString(Mod.Operation), Mod.Magnitude.StaticValue);
+			if (Trace)
+			{
+				Trace->Record(ELuxTraceEvent::ApplyInstantModifier, Mod.Attribute.GetAttributeId(), INDEX_NONE, static_cast<uint16>(Mod.Operation),
+					FGameplayTag(), FGameplayTag(), CurrentBaseValue, NewBaseValue, Mod.Magnitude.StaticValue);
+			}
 
 			SetNumericAttributeBase(Mod.Attribute, NewBaseValue);
 
@@ -1832,8 +2032,6 @@ void UActionSystemComponent::ApplyModifiers(const FLuxEffectSpec& Spec)
 	// 지속/무한 효과는 모든 활성 효과를 다시 계산하여 CurrentValue를 갱신합니다.
 	else
 	{
-		UE_LOG(LogLuxActionSystem, Log, TEXT("  -> 지속(Duration/Infinite) 효과로 처리합니다. CurrentValue를 재계산합니다."));
-
 		TSet<FLuxAttribute> AffectedAttributes;
 		for (const FAttributeModifier& Mod : Spec.CalculatedModifiers)
 		{
@@ -1845,8 +2043,11 @@ void UActionSystemComponent::ApplyModifiers(const FLuxEffectSpec& Spec)
 
 		for (const FLuxAttribute& Attr : AffectedAttributes)
 		{
-			UE_LOG(LogLuxActionSystem, Log, TEXT("    -> 재계산 대상 속성: '%s'"), *Attr.GetName().ToString());
-			RecalculateCurrentAttributeValue(Attr);
+			if (Trace)
+			{
+				Trace->Record(ELuxTraceEvent::MarkAttributeDirty, Attr.GetAttributeId());
+			}
+			MarkAttributeDirty(Attr);
 		}
 
 		for (const FAttributeModifier& Mod : Spec.CalculatedModifiers)
@@ -1860,7 +2061,6 @@ void UActionSystemComponent::ApplyModifiers(const FLuxEffectSpec& Spec)
 			}
 		}
 	}
-	UE_LOG(LogLuxActionSystem, Log, TEXT("<< [ApplyModifiers] Modifier 적용 완료."));
 }
 
 FActiveLuxEffectHandle UActionSystemComponent::AddOrUpdateActiveEffect(const FLuxEffectSpec& AppliedSpec)
@@ -1904,12 +2104,15 @@ FActiveLuxEffectHandle UActionSystemComponent::FindExistingEffectHandle(const FL
 
 FActiveLuxEffectHandle UActionSystemComponent::UpdateExistingEffect(FActiveLuxEffectHandle ExistingHandle, const FLuxEffectSpec& AppliedSpec)
 {
-	FActiveLuxEffect* ExistingEffect = FindActiveEffectFromHandle(ExistingHandle);
-	if (!ExistingEffect)
+	// AddOrUpdateActiveEffect 가 이미 쓰기 락을 보유하고 있으므로 락 없이 색인을 직접 조회합니다.
+	const int32 ExistingIndex = ActiveLuxEffects.IndexOfHandle(ExistingHandle);
+	if (ExistingIndex == INDEX_NONE)
 	{
 		return FActiveLuxEffectHandle();
 	}
 
+	FActiveLuxEffect* ExistingEffect = &ActiveLuxEffects.Items[ExistingIndex];
+
 	const ULuxEffect* Template = AppliedSpec.EffectTemplate.Get();
 	if (!Template)
 	{
@@ -1920,6 +2123,7 @@ FActiveLuxEffectHandle UActionSystemComponent::UpdateExistingEffect(FActiveLuxEf
 	const int32 MaxStacks = Template->MaxStacks > 0 ? Template->MaxStacks : 1;
 	ExistingEffect->CurrentStacks = FMath::Min(ExistingEffect->CurrentStacks + 1, MaxStacks);
 	ExistingEffect->EndTime = GetWorld()->GetTimeSeconds() + AppliedSpec.CalculatedDuration;
+	UpdateEffectStacksInAggregators(*ExistingEffect);
 
 	// Replace 정책인 경우 타이머 재설정
 	if (Template->StackingType == EEffectStackingType::Replace)
@@ -1941,9 +2145,11 @@ FActiveLuxEffectHandle UActionSystemComponent::AddNewEffect(const FLuxEffectSpec
 
 	// 새로운 효과 생성
 	FActiveLuxEffect& NewActiveEffect = ActiveLuxEffects.Items.Emplace_GetRef(AppliedSpec);
+	ActiveLuxEffects.HandleIndex.Add(NewActiveEffect.Handle.Handle, ActiveLuxEffects.Items.Num() - 1);
 	NewActiveEffect.StartTime = GetWorld()->GetTimeSeconds();
 	NewActiveEffect.EndTime = GetWorld()->GetTimeSeconds() + AppliedSpec.CalculatedDuration;
 	NewActiveEffect.CurrentStacks = 1;
+	AddEffectToAggregators(NewActiveEffect);
 
 	// 동적 태그 부여
 	for (const FGameplayTag& Tag : AppliedSpec.DynamicGrantedTags)
@@ -1968,30 +2174,19 @@ void UActionSystemComponent::UpdateEffectTimers(FActiveLuxEffect* ExistingEffect
 		return;
 	}
 
-	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
-
-	// 만료 타이머 재설정
-	if (FTimerHandle* TimerHandle = ExpirationTimerMap.Find(ExistingEffect->Handle))
-	{
-		TimerManager.ClearTimer(*TimerHandle);
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActionSystemComponent::OnEffectExpired, ExistingEffect->Handle);
-		TimerManager.SetTimer(*TimerHandle, Delegate, AppliedSpec.CalculatedDuration, false);
-	}
+	const float Now = GetWorld()->GetTimeSeconds();
 
-	// 주기 타이머 재설정
-	if (FTimerHandle* TimerHandle = PeriodTimerMap.Find(ExistingEffect->Handle))
+	// 만료 예약 재설정
+	if (EffectScheduler.HasExpiration(ExistingEffect->Handle))
 	{
-		TimerManager.ClearTimer(*TimerHandle);
+		EffectScheduler.ScheduleExpiration(ExistingEffect->Handle, Now + AppliedSpec.CalculatedDuration);
 	}
 
+	// 주기 예약 재설정
+	EffectScheduler.CancelPeriod(ExistingEffect->Handle);
 	if (AppliedSpec.CalculatedPeriod > 0.f)
 	{
-		FTimerHandle NewPeriodTimer;
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActionSystemComponent::OnPeriodicEffectTick, ExistingEffect->Handle);
-		TimerManager.SetTimer(NewPeriodTimer, Delegate, AppliedSpec.CalculatedPeriod, true);
-		PeriodTimerMap.Add(ExistingEffect->Handle, NewPeriodTimer);
+		EffectScheduler.SchedulePeriod(ExistingEffect->Handle, Now + AppliedSpec.CalculatedPeriod, AppliedSpec.CalculatedPeriod);
 	}
 }
 
@@ -2008,26 +2203,18 @@ void UActionSystemComponent::SetupEffectTimers(FActiveLuxEffect& NewActiveEffect
 		return;
 	}
 
-	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	const float Now = GetWorld()->GetTimeSeconds();
 
-	// 만료 타이머 설정
+	// 만료 예약
 	if (AppliedSpec.CalculatedDuration > 0.f)
 	{
-		FTimerHandle NewTimerHandle;
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActionSystemComponent::OnEffectExpired, NewActiveEffect.Handle);
-		TimerManager.SetTimer(NewTimerHandle, Delegate, AppliedSpec.CalculatedDuration, false);
-		ExpirationTimerMap.Add(NewActiveEffect.Handle, NewTimerHandle);
+		EffectScheduler.ScheduleExpiration(NewActiveEffect.Handle, Now + AppliedSpec.CalculatedDuration);
 	}
 
-	// 주기 타이머 설정
+	// 주기 예약
 	if (AppliedSpec.CalculatedPeriod > 0.f)
 	{
-		FTimerHandle NewPeriodTimer;
-		FTimerDelegate Delegate;
-		Delegate.BindUObject(this, &UActionSystemComponent::OnPeriodicEffectTick, NewActiveEffect.Handle);
-		TimerManager.SetTimer(NewPeriodTimer, Delegate, AppliedSpec.CalculatedPeriod, true);
-		PeriodTimerMap.Add(NewActiveEffect.Handle, NewPeriodTimer);
+		EffectScheduler.SchedulePeriod(NewActiveEffect.Handle, Now + AppliedSpec.CalculatedPeriod, AppliedSpec.CalculatedPeriod);
 	}
 }
 
@@ -2053,30 +2240,15 @@ FActiveLuxEffect* UActionSystemComponent::FindActiveEffectFromHandle(const FActi
 		return nullptr;
 	}
 
-	//{
-	//	// 맵에서 먼저 검색합니다.
-	//	FRWScopeLock ReadLock(ActiveLuxEffectsLock, FRWScopeLockType::SLT_ReadOnly);
-	//	if (FActiveLuxEffect** FoundEffectPtr = ActiveEffectMap.Find(Handle))
-	//	{
-	//		return *FoundEffectPtr;
-	//	}
-	//}
+	FRWScopeLock ReadLock(ActiveLuxEffectsLock, FRWScopeLockType::SLT_ReadOnly);
+	const int32 Index = ActiveLuxEffects.IndexOfHandle(Handle);
 
+	if (ULuxTraceRecorder* Trace = ULuxTraceRecorder::Get(this))
 	{
-		// 맵에 없다면 원본 배열을 순회하여 다시 검색합니다.
-		FRWScopeLock ReadLock(ActiveLuxEffectsLock, FRWScopeLockType::SLT_ReadOnly);
-		for (FActiveLuxEffect& Effect : ActiveLuxEffects.Items)
-		{
-			if (Effect.Handle == Handle)
-			{
-				//ActiveEffectMap.Add(Handle, &Effect);
-				UE_LOG(LogLuxActionSystem, Log, TEXT("FindActiveEffectFromHandle: Found effect for handle %s via array search."), *Handle.ToString());
-				return &Effect;
-			}
-		}
+		Trace->Record(ELuxTraceEvent::FindActiveEffect, Handle.Handle, Index);
 	}
 
-	return nullptr;
+	return Index != INDEX_NONE ? &ActiveLuxEffects.Items[Index] : nullptr;
 }
 
 void UActionSystemComponent::OnEffectExpired(FActiveLuxEffectHandle Handle)
@@ -2086,19 +2258,28 @@ void UActionSystemComponent::OnEffectExpired(FActiveLuxEffectHandle Handle)
 		return;
 	}
 
-	const int32 FoundIndex = ActiveLuxEffects.Items.IndexOfByPredicate([&Handle](const FActiveLuxEffect& Effect)
+	FActiveLuxEffect ExpiredEffect;
+	bool bRemoved = false;
+	{
+		FRWScopeLock WriteLock(ActiveLuxEffectsLock, FRWScopeLockType::SLT_Write);
+		const int32 FoundIndex = ActiveLuxEffects.IndexOfHandle(Handle);
+		if (FoundIndex != INDEX_NONE)
 		{
-			return Effect.Handle == Handle;
-		});
+			// 배열에서 제거하기 전에 만료된 이펙트의 데이터를 복사합니다.
+			ExpiredEffect = ActiveLuxEffects.Items[FoundIndex];
 
-	if (FoundIndex != INDEX_NONE)
-	{
-		// 배열에서 제거하기 전에 만료된 이펙트의 데이터를 복사합니다.
-		const FActiveLuxEffect ExpiredEffect = ActiveLuxEffects.Items[FoundIndex];
-		const TArray<FAttributeModifier> ModsToRecalculate = ExpiredEffect.Spec.CalculatedModifiers;
+			// 속성 재계산이 적용 순서에 의존하므로 배열 순서를 유지한 채 제거합니다.
+			ActiveLuxEffects.Items.RemoveAt(FoundIndex);
+			ActiveLuxEffects.HandleIndex.RemoveAt(FoundIndex);
+			ActiveLuxEffects.MarkArrayDirty();
+			bRemoved = true;
+		}
+	}
 
-		ActiveLuxEffects.Items.RemoveAt(FoundIndex);
-		ActiveLuxEffects.MarkArrayDirty();
+	if (bRemoved)
+	{
+		const TArray<FAttributeModifier>& ModsToRecalculate = ExpiredEffect.Spec.CalculatedModifiers;
+		RemoveEffectFromAggregators(ExpiredEffect);
 
         // 네이티브 이펙트 제거 델리게이트 (서버)
         OnEffectRemovedNative.Broadcast(ExpiredEffect);
@@ -2109,17 +2290,8 @@ void UActionSystemComponent::OnEffectExpired(FActiveLuxEffectHandle Handle)
 			RemoveTag(Tag, 1);
 		}
 
-		// 이펙트와 관련된 모든 타이머를 정리합니다.
-		if (FTimerHandle* Timer = ExpirationTimerMap.Find(Handle))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(*Timer);
-			ExpirationTimerMap.Remove(Handle);
-		}
-		if (FTimerHandle* Timer = PeriodTimerMap.Find(Handle))
-		{
-			GetWorld()->GetTimerManager().ClearTimer(*Timer);
-			PeriodTimerMap.Remove(Handle);
-		}
+		// 이펙트와 관련된 모든 예약을 정리합니다.
+		EffectScheduler.CancelAll(Handle);
 
 		// 이펙트 제거의 영향을 받는 모든 속성 값을 재계산합니다.
 		TSet<FLuxAttribute> AffectedAttributes;
@@ -2130,7 +2302,7 @@ void UActionSystemComponent::OnEffectExpired(FActiveLuxEffectHandle Handle)
 
 		for (const FLuxAttribute& Attr : AffectedAttributes)
 		{
-			RecalculateCurrentAttributeValue(Attr);
+			MarkAttributeDirty(Attr);
 		}
 	}
 }
@@ -2142,16 +2314,48 @@ void UActionSystemComponent::OnPeriodicEffectTick(FActiveLuxEffectHandle Handle)
 		return;
 	}
 
-	FActiveLuxEffect* FoundEffect = ActiveLuxEffects.Items.FindByPredicate([&Handle](const FActiveLuxEffect& Effect) {
-		return Effect.Handle == Handle;
-		});
+	// ApplyModToAttribute 의 콜백이 이펙트 배열을 변경할 수 있으므로 Modifier 목록을 복사해 둡니다.
+	TArray<FAttributeModifier, TInlineAllocator<4>> ModsToApply;
+	int32 Stacks = 0;
+	{
+		FRWScopeLock ReadLock(ActiveLuxEffectsLock, FRWScopeLockType::SLT_ReadOnly);
+		const int32 FoundIndex = ActiveLuxEffects.IndexOfHandle(Handle);
+		if (FoundIndex == INDEX_NONE)
+		{
+			return;
+		}
 
-	if (FoundEffect)
+		ModsToApply.Append(ActiveLuxEffects.Items[FoundIndex].Spec.CalculatedModifiers);
+		Stacks = ActiveLuxEffects.Items[FoundIndex].CurrentStacks;
+	}
+
+	for (const FAttributeModifier& Mod : ModsToApply)
 	{
-		for (const FAttributeModifier& Mod : FoundEffect->Spec.CalculatedModifiers)
+		const float MagnitudeToApply = Mod.Magnitude.StaticValue * Stacks;
+		ApplyModToAttribute(Mod.Attribute, Mod.Operation, MagnitudeToApply);
+	}
+}
+
+void UActionSystemComponent::ProcessScheduledEffects()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	EffectScheduler.Advance(World->GetTimeSeconds(), FiredEffectEvents);
+
+	// 콜백 도중 새 이펙트가 예약될 수 있으므로 수집이 끝난 목록을 순서대로 처리합니다.
+	for (const FLuxScheduledEffectFire& Fired : FiredEffectEvents)
+	{
+		if (Fired.Event == ELuxScheduledEffectEvent::Expiration)
+		{
+			OnEffectExpired(Fired.Handle);
+		}
+		else
 		{
-			const float MagnitudeToApply = Mod.Magnitude.StaticValue * FoundEffect->CurrentStacks;
-			ApplyModToAttribute(Mod.Attribute, Mod.Operation, MagnitudeToApply);
+			OnPeriodicEffectTick(Fired.Handle);
 		}
 	}
 }
@@ -2222,17 +2426,12 @@ void UActionSystemComponent::AdjustCooldownTimerByTag(const FGameplayTag& Cooldo
     FoundCooldown->EndTime = Now + NewRemainingSeconds;
     ActiveLuxEffects.MarkItemDirty(*FoundCooldown);
 
-    // 타이머 재설정
-    if (FTimerHandle* TimerHandle = ExpirationTimerMap.Find(FoundCooldown->Handle))
+    // 만료 예약 재설정
+    if (EffectScheduler.HasExpiration(FoundCooldown->Handle))
     {
-        GetWorld()->GetTimerManager().ClearTimer(*TimerHandle);
-
-        FTimerDelegate Delegate;
-        Delegate.BindUObject(this, &UActionSystemComponent::OnEffectExpired, FoundCooldown->Handle);
-
         if (NewRemainingSeconds > 0.f)
         {
-            GetWorld()->GetTimerManager().SetTimer(*TimerHandle, Delegate, NewRemainingSeconds, false);
+            EffectScheduler.ScheduleExpiration(FoundCooldown->Handle, GetWorld()->GetTimeSeconds() + NewRemainingSeconds);
         }
         else
         {
@@ -2591,6 +2790,7 @@ void UActionSystemComponent::ApplyModToAttribute(const FLuxAttribute& Attribute,
 	if (!FMath::IsNearlyEqual(OldValue, NewValue))
 	{
 		Data->SetCurrentValue(NewValue);
+		NotifyAttributeValueChanged(Attribute);
 		Set->PostAttributeChange(Attribute, OldValue, NewValue);
 	}
 }
@@ -2606,90 +2806,101 @@ void UActionSystemComponent::RecalculateCurrentAttributeValue(const FLuxAttribut
 	}
 
 	const float OldCurrentValue = Data->GetCurrentValue();
-	float NewCurrentValue = Data->GetBaseValue();
 
-	float OverrideValue = -1.f;
-	bool bHasOverride = false;
+	// 집계기는 Override -> Multiply -> Add 순서의 기존 공식과 동일한 결과를 캐시된 합산 값으로 계산합니다.
+	// 예: 10% 증가는 1.1, 2스택이면 (1.0 + (0.1 * 2)) = 1.2배의 덧셈 기반 배율입니다.
+	float NewCurrentValue = AttributeAggregators.FindOrAdd(Attribute).Evaluate(Data->GetBaseValue());
 
-	for (const FActiveLuxEffect& ActiveEffect : ActiveLuxEffects.Items)
+	// 최종 계산된 값이 변경되었을 때만 이벤트를 호출하고 값을 설정합니다.
+	if (!FMath::IsNearlyEqual(OldCurrentValue, NewCurrentValue))
 	{
-		if (ActiveEffect.Spec.EffectTemplate->DurationPolicy == ELuxEffectDurationPolicy::Instant)
-			continue;
+		Set->PreAttributeChange(Attribute, NewCurrentValue);
+		Data->SetCurrentValue(NewCurrentValue);
+		NotifyAttributeValueChanged(Attribute);
+		Set->PostAttributeChange(Attribute, OldCurrentValue, NewCurrentValue);
+	}
+}
 
-		for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
+void UActionSystemComponent::MarkAttributeDirty(const FLuxAttribute& Attribute)
+{
+	if (!bDeferAttributeRecalculation)
+	{
+		RecalculateCurrentAttributeValue(Attribute);
+		return;
+	}
+
+	// 한 프레임에 더티로 표시되는 속성 수는 적으므로 선형 중복 검사로 충분합니다.
+	DirtyAttributes.AddUnique(Attribute);
+}
+
+void UActionSystemComponent::FlushDirtyAttributes()
+{
+	// 재계산 도중 PostAttributeChange 에서 다른 속성이 더티로 표시될 수 있으므로, 목록이 빌 때까지 반복합니다.
+	while (DirtyAttributes.Num() > 0)
+	{
+		TArray<FLuxAttribute, TInlineAllocator<8>> AttributesToFlush;
+		AttributesToFlush.Append(DirtyAttributes);
+		DirtyAttributes.Reset();
+
+		// CurrentValue 는 플러시 전까지 갱신되지 않으므로, 속성마다 프레임 시작 값 -> 최종 값의 변경 이벤트가 한 번만 발생합니다.
+		for (const FLuxAttribute& Attr : AttributesToFlush)
 		{
-			if (Mod.Attribute == Attribute && Mod.Operation == EModifierOperation::Override)
-			{
-				OverrideValue = Mod.Magnitude.StaticValue; // 스택은 반영 X
-				bHasOverride = true;
-			}
+			RecalculateCurrentAttributeValue(Attr);
 		}
 	}
+}
 
-	if (bHasOverride)
+void UActionSystemComponent::AddEffectToAggregators(const FActiveLuxEffect& ActiveEffect)
+{
+	const ULuxEffect* Template = ActiveEffect.Spec.EffectTemplate.Get();
+	if (!Template || Template->DurationPolicy == ELuxEffectDurationPolicy::Instant)
 	{
-		NewCurrentValue = OverrideValue;
+		return;
 	}
-	else
+
+	// 새 효과는 항상 활성 배열의 끝에 추가되므로, Modifier 도 각 집계기의 끝에 추가하면 적용 순서가 유지됩니다.
+	for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
 	{
-		// 곱셈 및 나눗셈 연산 처리 
-		float TotalMultiplier = 1.0f;
-		for (const FActiveLuxEffect& ActiveEffect : ActiveLuxEffects.Items)
-		{
-			if (ActiveEffect.Spec.EffectTemplate->DurationPolicy == ELuxEffectDurationPolicy::Instant) continue;
-			for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
-			{
-				if (Mod.Attribute == Attribute && Mod.Operation == EModifierOperation::Multiply)
-				{
-					// 스택이 적용된 배율을 곱합니다.
-					// 예: 10% 증가는 1.1, 2스택이면 (1.0 + (0.1 * 2)) = 1.2배. 또는 (1.1^2) 등 정책에 따라 결정.
-					// 여기서는 간단한 덧셈 기반 배율로 가정합니다. 1.0f + ( (Mod.Magnitude - 1.0f) * 스택 )
-					TotalMultiplier += (Mod.Magnitude.StaticValue - 1.0f) * ActiveEffect.CurrentStacks;
-				}
-			}
-		}
-		NewCurrentValue *= TotalMultiplier;
+		AttributeAggregators.FindOrAdd(Mod.Attribute).AddMod(ActiveEffect.Handle, Mod.Operation, Mod.Magnitude.StaticValue, ActiveEffect.CurrentStacks);
+	}
+}
 
-		// 덧셈 및 뺄셈 연산 처리 ---
-		float TotalAddition = 0.0f;
-		for (const FActiveLuxEffect& ActiveEffect : ActiveLuxEffects.Items)
+void UActionSystemComponent::RemoveEffectFromAggregators(const FActiveLuxEffect& ActiveEffect)
+{
+	for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
+	{
+		if (FLuxAttributeAggregator* Aggregator = AttributeAggregators.Find(Mod.Attribute))
 		{
-			if (ActiveEffect.Spec.EffectTemplate->DurationPolicy == ELuxEffectDurationPolicy::Instant) continue;
-			for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
-			{
-				if (Mod.Attribute == Attribute && Mod.Operation == EModifierOperation::Add)
-				{
-					TotalAddition += Mod.Magnitude.StaticValue * ActiveEffect.CurrentStacks;
-				}
-			}
+			Aggregator->RemoveMods(ActiveEffect.Handle);
 		}
-		NewCurrentValue += TotalAddition;
 	}
+}
 
-	// 최종 계산된 값이 변경되었을 때만 이벤트를 호출하고 값을 설정합니다.
-	if (!FMath::IsNearlyEqual(OldCurrentValue, NewCurrentValue))
+void UActionSystemComponent::UpdateEffectStacksInAggregators(const FActiveLuxEffect& ActiveEffect)
+{
+	for (const FAttributeModifier& Mod : ActiveEffect.Spec.CalculatedModifiers)
 	{
-		Set->PreAttributeChange(Attribute, NewCurrentValue);
-		Data->SetCurrentValue(NewCurrentValue);
-		Set->PostAttributeChange(Attribute, OldCurrentValue, NewCurrentValue);
+		if (FLuxAttributeAggregator* Aggregator = AttributeAggregators.Find(Mod.Attribute))
+		{
+			Aggregator->SetStacks(ActiveEffect.Handle, ActiveEffect.CurrentStacks);
+		}
 	}
 }
 
 void UActionSystemComponent::RecalculateAllCurrentAttributeValues()
 {
+	FLuxAttributeRegistry& Registry = FLuxAttributeRegistry::Get();
+
 	for (ULuxAttributeSet* Set : GreantedAttributes)
 	{
 		if (!Set) continue;
 
-		for (TFieldIterator<FProperty> PropIt(Set->GetClass()); PropIt; ++PropIt)
+		// 클래스별로 미리 구성된 속성 ID 목록을 사용하여 리플렉션 순회를 피합니다.
+		for (const int32 AttributeId : Registry.GetAttributeIdsForClass(Set->GetClass()))
 		{
-			if (FStructProperty* StructProp = CastField<FStructProperty>(*PropIt))
+			if (const FLuxAttributeInfo* Info = Registry.GetAttributeInfo(AttributeId))
 			{
-				if (StructProp->Struct == FLuxAttributeData::StaticStruct())
-				{
-					FLuxAttribute Attr(StructProp);
-					RecalculateCurrentAttributeValue(Attr);
-				}
+				RecalculateCurrentAttributeValue(FLuxAttribute(*Info));
 			}
 		}
 	}
@@ -2719,6 +2930,7 @@ void UActionSystemComponent::SetNumericAttributeBase(const FLuxAttribute& Attrib
 	float TempNewValue = NewBaseValue;
 	Set->PreAttributeBaseChange(Attribute, TempNewValue);
 	Data->SetBaseValue(TempNewValue);
+	NotifyAttributeValueChanged(Attribute);
 	Set->PostAttributeBaseChange(Attribute, OldValue, Data->GetBaseValue());
 
 	RecalculateCurrentAttributeValue(Attribute);
@@ -2742,6 +2954,30 @@ float UActionSystemComponent::GetNumericAttributeBase(const FLuxAttribute& Attri
 void UActionSystemComponent::SetSpawnedAttributesDirty()
 {
 	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, GreantedAttributes, this);
+
+	// 속성 셋 구성이 바뀌면 비용 판정의 전제가 달라지므로 캐시된 활성화 판정을 모두 버립니다.
+	ActivationVerdicts.Reset();
+}
+
+void UActionSystemComponent::NotifyAttributeValueChanged(const FLuxAttribute& Attribute)
+{
+	const int32 AttributeId = Attribute.GetAttributeId();
+	if (AttributeId == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (AttributeId >= AttributeVersions.Num())
+	{
+		AttributeVersions.SetNumZeroed(AttributeId + 1);
+	}
+	++AttributeVersions[AttributeId];
+}
+
+uint32 UActionSystemComponent::GetAttributeVersion(const FLuxAttribute& Attribute) const
+{
+	const int32 AttributeId = Attribute.GetAttributeId();
+	return AttributeVersions.IsValidIndex(AttributeId) ? AttributeVersions[AttributeId] : 0;
 }
 
 /* ======================================== Input Management ======================================== */
@@ -2771,10 +3007,10 @@ void UActionSystemComponent::InvokeReplicatedEvent(EActionReplicatedEvent EventT
 	{
 		ServerInvokeReplicatedEvent(EventType, SpecHandle);
 	}
-	// 클라이언트에서 서버로 RPC 전송
+	// 클라이언트에서 서버로 RPC 전송 (같은 프레임의 활성화 요청과 순서를 맞추기 위해 번들을 거칩니다)
 	else
 	{
-		ServerInvokeReplicatedEvent(EventType, SpecHandle);
+		SendReplicatedEventToServer(EventType, SpecHandle);
 	}
 }
 
@@ -2797,14 +3033,22 @@ void UActionSystemComponent::ServerInvokeReplicatedEvent_Implementation(EActionR
 
 void UActionSystemComponent::ActionInputTagPressed(FGameplayTag InputTag)
 {
-	FRWScopeLock WriteLock(InputHandlesLock, FRWScopeLockType::SLT_Write);
-
-	for (FLuxActionSpec& Spec : LuxActionSpecs.Items)
 	{
-		if (Spec.Action && Spec.DynamicTags.HasTagExact(InputTag))
+		FRWScopeLock SpecsReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
+		FRWScopeLock WriteLock(InputHandlesLock, FRWScopeLockType::SLT_Write);
+
+		if (bInputRoutesDirty)
 		{
-			InputPressedSpecHandles.AddUnique(Spec.Handle);
-			InputHeldSpecHandles.AddUnique(Spec.Handle);
+			RebuildInputRouting_Locked();
+		}
+
+		if (const FLuxInputRoute* Route = InputRoutes.Find(InputTag))
+		{
+			for (const FLuxActionSpecHandle& SpecHandle : Route->SpecHandles)
+			{
+				InputPressedSpecHandles.AddUnique(SpecHandle);
+				InputHeldSpecHandles.AddUnique(SpecHandle);
+			}
 		}
 	}
 
@@ -2813,18 +3057,81 @@ void UActionSystemComponent::ActionInputTagPressed(FGameplayTag InputTag)
 
 void UActionSystemComponent::ActionInputTagReleased(FGameplayTag InputTag)
 {
+	{
+		FRWScopeLock SpecsReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
+		FRWScopeLock WriteLock(InputHandlesLock, FRWScopeLockType::SLT_Write);
+
+		if (bInputRoutesDirty)
+		{
+			RebuildInputRouting_Locked();
+		}
+
+		if (const FLuxInputRoute* Route = InputRoutes.Find(InputTag))
+		{
+			for (const FLuxActionSpecHandle& SpecHandle : Route->SpecHandles)
+			{
+				InputHeldSpecHandles.Remove(SpecHandle);
+				InputReleasedSpecHandles.AddUnique(SpecHandle);
+			}
+		}
+	}
+
+	OnLocalInputTagReleased.Broadcast(InputTag);
+}
+
+void UActionSystemComponent::InitializeInputRouting(const ULuxInputConfig* InputConfig)
+{
+	FRWScopeLock SpecsReadLock(ActionSpecsLock, FRWScopeLockType::SLT_ReadOnly);
 	FRWScopeLock WriteLock(InputHandlesLock, FRWScopeLockType::SLT_Write);
 
-	for (FLuxActionSpec& Spec : LuxActionSpecs.Items)
+	InputRoutes.Reset();
+
+	if (InputConfig)
 	{
-		if (Spec.Action && Spec.DynamicTags.HasTagExact(InputTag))
+		for (const FLuxInputAction& Action : InputConfig->AbilityInputActions)
 		{
-			InputHeldSpecHandles.Remove(Spec.Handle);
-			InputReleasedSpecHandles.AddUnique(Spec.Handle);
+			// 구성된 입력 태그는 Spec 이 없더라도 동적 태그 매칭 대상이 되도록 미리 등록합니다.
+			if (Action.InputAction && Action.InputTag.IsValid())
+			{
+				InputRoutes.FindOrAdd(Action.InputTag);
+			}
 		}
 	}
 
-	OnLocalInputTagReleased.Broadcast(InputTag);
+	RebuildInputRouting_Locked();
+}
+
+void UActionSystemComponent::RebuildInputRouting_Locked()
+{
+	for (TPair<FGameplayTag, FLuxInputRoute>& Pair : InputRoutes)
+	{
+		Pair.Value.SpecHandles.Reset();
+	}
+
+	for (const FLuxActionSpec& Spec : LuxActionSpecs.Items)
+	{
+		if (!Spec.Action)
+		{
+			continue;
+		}
+
+		// 주 입력 태그는 입력 구성에 없더라도 항상 라우팅합니다.
+		if (Spec.InputTag.IsValid())
+		{
+			InputRoutes.FindOrAdd(Spec.InputTag).SpecHandles.AddUnique(Spec.Handle);
+		}
+
+		// 그 외 동적 태그는 이미 라우팅 대상인 입력 태그와 정확히 일치할 때만 추가합니다.
+		for (const FGameplayTag& DynamicTag : Spec.DynamicTags)
+		{
+			if (FLuxInputRoute* Route = InputRoutes.Find(DynamicTag))
+			{
+				Route->SpecHandles.AddUnique(Spec.Handle);
+			}
+		}
+	}
+
+	bInputRoutesDirty = false;
 }
 
 void UActionSystemComponent::ProcessActionInput(float DeltaTime, bool bGamePaused)
@@ -2911,6 +3218,9 @@ void UActionSystemComponent::ProcessActionInput(float DeltaTime, bool bGamePause
 void UActionSystemComponent::SetTagRelationshipMapping(ULuxActionTagRelationshipMapping* NewMapping)
 {
 	TagRelationshipMapping = NewMapping;
+
+	// 관계 매핑이 바뀌면 차단/필수 태그 판정이 달라지므로 캐시를 비웁니다.
+	ActivationVerdicts.Reset();
 }
 
 void UActionSystemComponent::Server_AddTag_Implementation(const FGameplayTag& Tag, int32 StackCount)
@@ -2924,8 +3234,8 @@ void UActionSystemComponent::AddTag(const FGameplayTag& Tag, int32 StackCount)
 
 	const int32 OldCount = GrantedTags.GetStackCount(Tag);
 	GrantedTags.AddStack(Tag, StackCount);
-	GrantedTags.MarkArrayDirty();
 	const int32 NewCount = GrantedTags.GetStackCount(Tag);
+	RefreshMovementBlocked();
 
 	// 변경이 있었을 경우에만 델리게이트를 호출합니다.
 	if (OldCount != NewCount)
@@ -2942,7 +3252,6 @@ void UActionSystemComponent::AddTags(const FGameplayTagContainer& TagContainer,
 	{
 		const int32 OldCount = GrantedTags.GetStackCount(Tag);
 		GrantedTags.AddStack(Tag, StackCount);
-		GrantedTags.MarkArrayDirty();
 		const int32 NewCount = GrantedTags.GetStackCount(Tag);
 
 		if (OldCount != NewCount)
@@ -2950,6 +3259,8 @@ void UActionSystemComponent::AddTags(const FGameplayTagContainer& TagContainer,
 			OnGameplayTagStackChanged.Broadcast(Tag, OldCount, NewCount);
 		}
 	}
+
+	RefreshMovementBlocked();
 }
 
 void UActionSystemComponent::Server_RemoveTag_Implementation(const FGameplayTag& Tag, int32 StackCount)
@@ -2963,8 +3274,8 @@ void UActionSystemComponent::RemoveTag(const FGameplayTag& Tag, int32 StackCount
 
 	const int32 OldCount = GrantedTags.GetStackCount(Tag);
 	GrantedTags.RemoveStack(Tag, StackCount);
-	GrantedTags.MarkArrayDirty();
 	const int32 NewCount = GrantedTags.GetStackCount(Tag);
+	RefreshMovementBlocked();
 
 	if (OldCount != NewCount)
 	{
@@ -2980,7 +3291,6 @@ void UActionSystemComponent::RemoveTags(const FGameplayTagContainer& TagContaine
 	{
 		const int32 OldCount = GrantedTags.GetStackCount(Tag);
 		GrantedTags.RemoveStack(Tag, StackCount);
-		GrantedTags.MarkArrayDirty();
 		const int32 NewCount = GrantedTags.GetStackCount(Tag);
 
 		if (OldCount != NewCount)
@@ -2988,6 +3298,8 @@ void UActionSystemComponent::RemoveTags(const FGameplayTagContainer& TagContaine
 			OnGameplayTagStackChanged.Broadcast(Tag, OldCount, NewCount);
 		}
 	}
+
+	RefreshMovementBlocked();
 }
 
 bool UActionSystemComponent::HasTag(const FGameplayTag& Tag) const
@@ -2997,28 +3309,17 @@ bool UActionSystemComponent::HasTag(const FGameplayTag& Tag) const
 
 bool UActionSystemComponent::HasAny(const FGameplayTagContainer& TagContainer) const
 {
-	for (const FGameplayTag& Tag : TagContainer)
-	{
-		if (GrantedTags.ContainsTag(Tag))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return GrantedTags.HasAnyTags(TagContainer);
 }
 
 bool UActionSystemComponent::HasAll(const FGameplayTagContainer& TagContainer) const
 {
-	for (const FGameplayTag& Tag : TagContainer)
-	{
-		if (!GrantedTags.ContainsTag(Tag))
-		{
-			return false;
-		}
-	}
+	return GrantedTags.HasAllTags(TagContainer);
+}
 
-	return true;
+bool UActionSystemComponent::MatchesTagQuery(const FLuxCompiledTagQuery& Query) const
+{
+	return GrantedTags.MatchesQuery(Query);
 }
 
 int32 UActionSystemComponent::GetTagStackCount(const FGameplayTag& Tag) const
@@ -3026,11 +3327,21 @@ int32 UActionSystemComponent::GetTagStackCount(const FGameplayTag& Tag) const
 	return GrantedTags.GetStackCount(Tag);
 }
 
-FGameplayTagContainer UActionSystemComponent::GetGameplayTags() const
+const FGameplayTagContainer& UActionSystemComponent::GetGameplayTags() const
 {
 	return GrantedTags.GetExplicitGameplayTags();
 }
 
+FOnGameplayTagCountChangedNative& UActionSystemComponent::RegisterGameplayTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType)
+{
+	return GrantedTags.RegisterTagEvent(Tag, EventType);
+}
+
+void UActionSystemComponent::UnregisterGameplayTagEvent(FDelegateHandle DelegateHandle, const FGameplayTag& Tag, ELuxTagEventType EventType)
+{
+	GrantedTags.UnregisterTagEvent(Tag, EventType, DelegateHandle);
+}
+
 /* ======================================== Gameplay Event System ======================================== */
 
 void UActionSystemComponent::HandleGameplayEvent(const FGameplayTag& EventTag, const FContextPayload& Payload)
@@ -3081,6 +3392,44 @@ void UActionSystemComponent::BroadcastGameplayEventToSubscribers(const FGameplay
     }
 }
 
+void UActionSystemComponent::UpdateMovementState(const UCharacterMovementComponent& MovementComponent)
+{
+	const FVector CurrentAcceleration = MovementComponent.GetCurrentAcceleration();
+	const bool bNowMoving = CurrentAcceleration.SizeSquared() > 0.f;
+
+	// 네이티브 구독자에게는 움직임이 시작되거나 멈춘 프레임에만 알립니다.
+	const bool bStateChanged = bNowMoving != MovementState.bIsMoving;
+	if (bStateChanged)
+	{
+		MovementState.bIsMoving = bNowMoving;
+		MovementState.Velocity = MovementComponent.Velocity;
+		MovementState.Acceleration = CurrentAcceleration;
+		OnMovementStateChangedNative.Broadcast(MovementState);
+	}
+
+	// Started 는 움직이는 동안 매 틱 전달합니다. 몽타주 태스크나 페이즈 전환 조건처럼 나중에 준비되는 구독자가 계속 움직이는 캐릭터를 놓치지 않도록 하기 위함입니다.
+	// Stopped 는 멈춘 프레임에만 전달합니다.
+	if (!bNowMoving && !bStateChanged)
+	{
+		return;
+	}
+
+	// 태그 기반 구독자가 있을 때만 페이로드를 생성합니다.
+	const FGameplayTag EventTag = bNowMoving ? LuxGameplayTags::Event_Movement_Started : LuxGameplayTags::Event_Movement_Stopped;
+	const FOnGameplayEvent* EventDelegate = EventSubscriptions.Find(EventTag);
+	if (!EventDelegate || !EventDelegate->IsBound())
+	{
+		return;
+	}
+
+	FContextPayload Payload;
+	FPayload_GameplayEventData EventData;
+	EventData.Instigator = GetAvatarActor();
+	Payload.SetData(LuxPayloadKeys::GameplayEventData, EventData);
+
+	BroadcastGameplayEventToSubscribers(EventTag, Payload);
+}
+
 // ======================================== Task Event Handling ========================================
 
 void UActionSystemComponent::Server_ReceiveTaskEvent_Implementation(FActiveLuxActionHandle ActionHandle, const FGameplayTag& EventTag, const FContextPayload& Payload)
@@ -3103,3 +3452,151 @@ void UActionSystemComponent::Server_ReceiveTaskEvent_Implementation(FActiveLuxAc
 	}
 }
 
+// ======================================== Server RPC Bundling ========================================
+
+void UActionSystemComponent::SendTryExecuteActionToServer(const FLuxActionSpecHandle Handle, FLuxPredictionKey PredictionKey)
+{
+	if (!bBundleServerRPCs || GetOwnerRole() == ROLE_Authority)
+	{
+		Server_TryExecuteAction(Handle, PredictionKey);
+		return;
+	}
+
+	FLuxServerRPCBundleEntry& Entry = PendingServerRPCBundle.Entries.AddDefaulted_GetRef();
+	Entry.Type = ELuxServerRPCType::TryExecuteAction;
+	Entry.SpecHandle = Handle;
+	Entry.PredictionKey = PredictionKey;
+
+	ScheduleServerRPCBundleFlush();
+}
+
+void UActionSystemComponent::SendTaskEventToServer(FActiveLuxActionHandle ActionHandle, const FGameplayTag& EventTag, const FContextPayload& Payload)
+{
+	if (!bBundleServerRPCs || GetOwnerRole() == ROLE_Authority)
+	{
+		Server_ReceiveTaskEvent(ActionHandle, EventTag, Payload);
+		return;
+	}
+
+	FLuxServerRPCBundleEntry& Entry = PendingServerRPCBundle.Entries.AddDefaulted_GetRef();
+	Entry.Type = ELuxServerRPCType::TaskEvent;
+	Entry.ActionHandle = ActionHandle;
+	Entry.EventTag = EventTag;
+	Entry.Payload = Payload;
+
+	ScheduleServerRPCBundleFlush();
+}
+
+void UActionSystemComponent::SendReplicatedEventToServer(EActionReplicatedEvent EventType, FLuxActionSpecHandle SpecHandle)
+{
+	if (!bBundleServerRPCs || GetOwnerRole() == ROLE_Authority)
+	{
+		ServerInvokeReplicatedEvent(EventType, SpecHandle);
+		return;
+	}
+
+	// 같은 프레임의 활성화 요청보다 입력 이벤트가 먼저 도착하지 않도록 같은 번들에 순서대로 담습니다.
+	FLuxServerRPCBundleEntry& Entry = PendingServerRPCBundle.Entries.AddDefaulted_GetRef();
+	Entry.Type = ELuxServerRPCType::ReplicatedEvent;
+	Entry.SpecHandle = SpecHandle;
+	Entry.ReplicatedEvent = EventType;
+
+	ScheduleServerRPCBundleFlush();
+}
+
+void UActionSystemComponent::ScheduleServerRPCBundleFlush()
+{
+	if (PendingServerRPCBundle.Entries.Num() >= FLuxServerRPCBundle::MaxEntries)
+	{
+		FlushServerRPCBundle();
+	}
+	else if (!ServerRPCBundleFlushHandle.IsValid())
+	{
+		ServerRPCBundleFlushHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UActionSystemComponent::HandleWorldPostActorTick);
+	}
+}
+
+void UActionSystemComponent::HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushServerRPCBundle();
+	}
+}
+
+void UActionSystemComponent::FlushServerRPCBundle()
+{
+	if (ServerRPCBundleFlushHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(ServerRPCBundleFlushHandle);
+		ServerRPCBundleFlushHandle.Reset();
+	}
+
+	if (PendingServerRPCBundle.Entries.Num() == 0)
+	{
+		return;
+	}
+
+	// 보내기 전에 대기열을 비워 두어야 아래 RPC 호출이 CallRemoteFunction 에서 다시 플러시를 일으키지 않습니다.
+	FLuxServerRPCBundle Bundle = MoveTemp(PendingServerRPCBundle);
+	PendingServerRPCBundle.Entries.Reset();
+
+	// 요청이 하나뿐이면 번들 헤더 없이 기존 RPC 로 보내는 편이 더 작습니다.
+	if (Bundle.Entries.Num() == 1)
+	{
+		const FLuxServerRPCBundleEntry& Entry = Bundle.Entries[0];
+		switch (Entry.Type)
+		{
+		case ELuxServerRPCType::TryExecuteAction:
+			Server_TryExecuteAction(Entry.SpecHandle, Entry.PredictionKey);
+			break;
+		case ELuxServerRPCType::TaskEvent:
+			Server_ReceiveTaskEvent(Entry.ActionHandle, Entry.EventTag, Entry.Payload);
+			break;
+		case ELuxServerRPCType::ReplicatedEvent:
+			ServerInvokeReplicatedEvent(Entry.ReplicatedEvent, Entry.SpecHandle);
+			break;
+		}
+		return;
+	}
+
+	UE_LOG(LogLuxActionSystem, Verbose, TEXT("[Client] Sending %d bundled server requests."), Bundle.Entries.Num());
+	Server_ExecuteRPCBundle(Bundle);
+}
+
+bool UActionSystemComponent::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	// 번들에 쌓인 요청보다 나중에 호출된 서버 RPC 가 먼저 도착하지 않도록, 번들 밖의 서버 RPC 를 보내기 전에 번들을 먼저 보냅니다.
+	if (PendingServerRPCBundle.Entries.Num() > 0 && Function && Function->HasAnyFunctionFlags(FUNC_NetServer))
+	{
+		FlushServerRPCBundle();
+	}
+
+	return Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+}
+
+void UActionSystemComponent::Server_ExecuteRPCBundle_Implementation(const FLuxServerRPCBundle& Bundle)
+{
+	if (!OwnerActor.IsValid() || !OwnerActor->HasAuthority())
+	{
+		return;
+	}
+
+	// 클라이언트에서 요청이 발생한 순서대로 기존 핸들러를 호출합니다.
+	for (const FLuxServerRPCBundleEntry& Entry : Bundle.Entries)
+	{
+		switch (Entry.Type)
+		{
+		case ELuxServerRPCType::TryExecuteAction:
+			Server_TryExecuteAction_Implementation(Entry.SpecHandle, Entry.PredictionKey);
+			break;
+		case ELuxServerRPCType::TaskEvent:
+			Server_ReceiveTaskEvent_Implementation(Entry.ActionHandle, Entry.EventTag, Entry.Payload);
+			break;
+		case ELuxServerRPCType::ReplicatedEvent:
+			ServerInvokeReplicatedEvent_Implementation(Entry.ReplicatedEvent, Entry.SpecHandle);
+			break;
+		}
+	}
+}
+
@@ -6,6 +6,7 @@
 #include "Actions/LuxAction.h"
 #include "Actions/LuxActionTypes.h"
 #include "Effects/LuxEffectTypes.h"
+#include "Effects/LuxEffectScheduler.h"
 #include "LuxActionSystemTypes.h"
 #include "NativeGameplayTags.h"
 #include "GameplayTagContainer.h"
@@ -30,12 +31,64 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGameplayEvent, const FGameplayTa
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnEffectAppliedNative, const FActiveLuxEffect&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnEffectRemovedNative, const FActiveLuxEffect&);
 
+/**
+ * 아바타의 이동 상태 스냅샷입니다. 값 타입이므로 힙 할당 없이 전달됩니다.
+ * 움직임이 시작되거나 멈추는 시점에만 갱신되므로, Velocity/Acceleration 은 현재 값이 아닌 그 시점의 값입니다.
+ */
+struct FLuxMovementState
+{
+	bool bIsMoving = false;
+
+	/** 마지막 시작/정지 시점의 속도. 현재 속도는 이동 컴포넌트에서 직접 읽으세요. */
+	FVector Velocity = FVector::ZeroVector;
+
+	/** 마지막 시작/정지 시점의 가속도 */
+	FVector Acceleration = FVector::ZeroVector;
+};
+
+// 네이티브 이동 상태 변경 알림 델리게이트 (움직임 시작/정지 시점에만 호출)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnMovementStateChangedNative, const FLuxMovementState&);
+
+/** 액션 Spec 별로 캐시된 활성화 가능 여부와 그 판정에 사용된 입력 버전들입니다. */
+struct FLuxActivationVerdict
+{
+	uint32 TagsVersion = 0;
+	uint32 CostAttributesVersion = 0;
+	int32 Level = INDEX_NONE;
+
+	bool bCanActivate = false;
+	FGameplayTagContainer FailureTags;
+};
+
 
 class ULuxActionTask;
 class ULuxAttributeSet;
 class APlayerController;
 class ULuxActionTagRelationshipMapping;
 class ULuxCooldownTracker;
+class UCharacterMovementComponent;
+class ULuxCharacterMovementComponent;
+class ULuxInputConfig;
+
+/** 입력 태그 하나에 대한 라우팅 정보입니다. */
+struct FLuxInputRoute
+{
+	/** 이 입력 태그로 발동되는 액션 Spec 핸들 목록 */
+	TArray<FLuxActionSpecHandle> SpecHandles;
+};
+
+/** PrepareSpecForApplication 에서 실행할 Execution 범위입니다. */
+enum class ELuxSpecPrepareStage : uint8
+{
+	/** 대상과 무관한 Execution 만 실행합니다. (다중 대상 적용 시 한 번만 실행) */
+	SourceOnly,
+
+	/** 대상에 의존하는 Execution 만 실행합니다. */
+	TargetOnly,
+
+	/** 모든 Execution 을 실행합니다. */
+	All,
+};
 
 struct FAttributeModifier;
 
@@ -94,6 +147,7 @@ protected:
 	virtual void OnRegister() override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
 	//~End of UActorComponent interface
 #pragma endregion
 
@@ -147,6 +201,13 @@ public:
 	/** 활성화된 액션이 종료되었을 때 호출됩니다. */
 	void OnActionEnd(const FActiveLuxActionHandle& Handle, bool bWasCancelled);
 
+	/**
+	 * 액션을 지금 활성화할 수 있는지와 실패 사유를 반환합니다.
+	 * 태그/비용 속성/레벨이 바뀌지 않았다면 캐시된 판정을 돌려주므로 UI 에서 매 프레임 호출해도 됩니다.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Actions")
+	bool GetActivationVerdict(FLuxActionSpecHandle Handle, FGameplayTagContainer& OutFailureTags) const;
+
 	/** 서버가 클라이언트에게 액션이 종료되었음을 알리고 취소 여부를 전달합니다. */
 	UFUNCTION(Client, Reliable)
 	void Client_NotifyActionEnded(FActiveLuxActionHandle Handle, bool bWasCancelled);
@@ -154,9 +215,15 @@ public:
 protected:
 	// ======================================== Action Activation Checks ========================================
 
-	/** 지정된 액션을 활성화할 수 있는지 모든 조건을 검사합니다. */
+	/** 지정된 액션을 활성화할 수 있는지 모든 조건을 검사합니다. (입력이 바뀌지 않았다면 캐시된 판정을 사용) */
 	bool CanActivateAction(FLuxActionSpecHandle Handle, FGameplayTagContainer& OutFailureTags) const;
 
+	/** 캐시를 거치지 않고 차단/필수 태그, 비용, 쿨다운을 순서대로 검사합니다. */
+	bool EvaluateActivationRequirements(const FLuxActionSpec& Spec, FGameplayTagContainer& OutFailureTags) const;
+
+	/** 액션 비용 이펙트가 참조하는 속성들의 버전 합을 반환합니다. */
+	uint32 GetCostAttributesVersion(const ULuxAction& Action) const;
+
 	/** 액션이 재사용 대기시간(Cooldown) 상태인지 확인합니다. */
 	virtual bool CheckCooldown(const FLuxActionSpec& Spec, FGameplayTagContainer& OutFailureTags) const;
 
@@ -164,10 +231,10 @@ protected:
 	virtual bool CheckCost(const FLuxActionSpec& Spec, FGameplayTagContainer& OutFailureTags) const;
 
 	/** 활성화를 막는 Blocked 태그를 가지고 있는지 확인합니다. */
-	virtual bool HasBlockedTags(const FLuxActionSpec& Spec, const FGameplayTagContainer& ActivationBlockedTags, FGameplayTagContainer& OutFailureTags) const;
+	virtual bool HasBlockedTags(const FLuxActionSpec& Spec, const FLuxCompiledTagQuery& ActivationBlockedQuery, FGameplayTagContainer& OutFailureTags) const;
 
 	/** 활성화에 필요한 Required 태그를 모두 가지고 있는지 확인합니다. */
-	virtual bool HasRequiredTags(const FLuxActionSpec& Spec, const FGameplayTagContainer& ActivationRequiredTags, FGameplayTagContainer& OutFailureTags) const;
+	virtual bool HasRequiredTags(const FLuxActionSpec& Spec, const FLuxCompiledTagQuery& ActivationRequiredQuery, FGameplayTagContainer& OutFailureTags) const;
 
 	// ======================================== Action Cancellation ========================================
 
@@ -213,6 +280,13 @@ public:
 
 	/** 현재 활성화된 모든 액션의 배열을 const 참조로 반환합니다. */
 	const TArray<FActiveLuxAction>& GetActiveActions() const;
+
+	/**
+	 * 부여된 액션 Spec 목록의 최신 불변 스냅샷을 반환합니다. 어떤 스레드에서든 호출할 수 있습니다.
+	 * 스냅샷은 Spec 이 바뀔 때만 새로 발행되므로, 받은 뒤에는 락 없이 핸들로 바로 찾을 수 있고 Spec 배열 재할당의 영향도 받지 않습니다.
+	 * UI, 툴팁, Execution, AI 평가처럼 Spec 을 읽기만 하는 곳에서는 FindActionSpecFromHandle 대신 이 함수를 사용합니다.
+	 */
+	FLuxActionSpecSnapshotPtr GetActionSpecSnapshot() const;
 	/** 네이티브 이펙트 적용 알림 (서버: AddNewEffect, 클라: OnRep_EffectAdded) */
 	FOnEffectAppliedNative OnEffectAppliedNative;
 	/** 네이티브 이펙트 제거 알림 (서버: OnEffectExpired, 클라: OnRep_EffectRemoved) */
@@ -246,6 +320,33 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void Server_ReceiveTaskEvent(FActiveLuxActionHandle ActionHandle, const FGameplayTag& EventTag, const FContextPayload& Payload);
 
+	/** 한 프레임 동안 묶인 액션 활성화 요청과 태스크 이벤트를 받아 기존 핸들러에 순서대로 전달합니다. */
+	UFUNCTION(Server, Reliable)
+	void Server_ExecuteRPCBundle(const FLuxServerRPCBundle& Bundle);
+
+	/** 액션 활성화 요청을 서버로 보냅니다. 번들링이 켜진 클라이언트에서는 프레임 끝에 묶어서 보냅니다. */
+	void SendTryExecuteActionToServer(const FLuxActionSpecHandle Handle, FLuxPredictionKey PredictionKey);
+
+	/** 태스크 이벤트를 서버로 보냅니다. 번들링이 켜진 클라이언트에서는 프레임 끝에 묶어서 보냅니다. */
+	void SendTaskEventToServer(FActiveLuxActionHandle ActionHandle, const FGameplayTag& EventTag, const FContextPayload& Payload);
+
+	/** 입력 눌림/뗌 이벤트를 서버로 보냅니다. 번들링이 켜진 클라이언트에서는 활성화 요청과 같은 번들에 순서대로 담습니다. */
+	void SendReplicatedEventToServer(EActionReplicatedEvent EventType, FLuxActionSpecHandle SpecHandle);
+
+public:
+	/**
+	 * 쌓여 있는 서버 요청 번들을 즉시 전송합니다. 요청이 하나뿐이면 기존 개별 RPC 로 보냅니다.
+	 * 번들 밖의 서버 RPC 가 호출되면 CallRemoteFunction 에서 먼저 이 함수를 호출하여 요청 순서를 유지합니다.
+	 */
+	void FlushServerRPCBundle();
+
+protected:
+	/** 번들이 가득 찼으면 즉시 전송하고, 아니면 프레임 끝 전송을 예약합니다. */
+	void ScheduleServerRPCBundleFlush();
+
+	/** 월드의 액터 틱이 모두 끝난 뒤(네트워크 전송 직전) 번들을 전송합니다. */
+	void HandleWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
 	/** 
 	 * 액션 활성화 성공을 알립니다.
 	 * @param Handle 활성화된 액션의 고유 핸들입니다.
@@ -287,6 +388,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Effects")
 	bool ApplyEffectSpecToTarget(const FLuxEffectSpecHandle& SpecHandle, UActionSystemComponent* TargetASC, FActiveLuxEffectHandle& OutActiveHandle);
 
+	/**
+	 * 하나의 이펙트 Spec 을 여러 대상에게 적용합니다.
+	 * 대상과 무관한 Execution 은 한 번만 실행하고, 대상별로는 대상 의존 Execution, 전제 조건 검사, 활성 효과 등록, Modifier 적용만 수행합니다.
+	 * 원본 Spec 은 변경되지 않으며, 각 대상은 TargetASC 가 설정된 자신만의 Spec 복사본을 받습니다. (OutResults 의 AppliedSpec)
+	 * @return 적용에 성공한 대상 수
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Effects")
+	int32 ApplyEffectSpecToTargets(const FLuxEffectSpecHandle& SpecHandle, const TArray<UActionSystemComponent*>& Targets, TArray<FLuxEffectTargetResult>& OutResults);
+
 	/** 현재 적용 중인 이펙트를 제거합니다. */
 	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Effects")
 	void RemoveEffect(FActiveLuxEffectHandle Handle);
@@ -312,11 +422,14 @@ public:
 	const TArray<FActiveLuxEffect>& GetActiveEffects() const;
 
 private:
-    /** 실제 이펙트 적용 로직을 처리하는 내부 함수입니다. 성공 여부를 반환하고, 지속 효과 핸들을 참조 인자로 돌려줍니다. */
-    virtual bool ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FActiveLuxEffectHandle& OutActiveHandle);
+    /**
+     * 실제 이펙트 적용 로직을 처리하는 내부 함수입니다. 성공 여부를 반환하고, 지속 효과 핸들을 참조 인자로 돌려줍니다.
+     * PrepareStage 로 실행할 Execution 범위를 지정합니다. (ApplyEffectSpecToTargets 는 대상 단계만 실행합니다)
+     */
+    virtual bool ApplyEffectSpec_Internal(FLuxEffectSpec& Spec, FActiveLuxEffectHandle& OutActiveHandle, ELuxSpecPrepareStage PrepareStage);
 
 	/** [1단계] Modifier 적용 전에 Execution 을 실행합니다. */
-	bool PrepareSpecForApplication(FLuxEffectSpec& Spec);
+	bool PrepareSpecForApplication(FLuxEffectSpec& Spec, ELuxSpecPrepareStage PrepareStage = ELuxSpecPrepareStage::All);
 
 	/** [2단계] AttributeSet의 전역 방어 로직을 실행합니다. */
 	bool CheckApplicationPrerequisites(FLuxEffectSpec& Spec);
@@ -438,6 +551,15 @@ public:
 	/** 지정된 속성의 BaseValue를 반환합니다. */
 	float GetNumericAttributeBase(const FLuxAttribute& Attribute) const;
 
+	/** 더티로 표시된 속성들의 CurrentValue 를 즉시 재계산합니다. 지연 재계산 모드에서 명시적인 동기화 지점으로 사용합니다. */
+	void FlushDirtyAttributes();
+
+	/** 속성 값이 바뀌었음을 기록합니다. (서버 변경 경로와 클라이언트 RepNotify 에서 호출) */
+	void NotifyAttributeValueChanged(const FLuxAttribute& Attribute);
+
+	/** 속성 값이 바뀔 때마다 증가하는 속성별 버전을 반환합니다. */
+	uint32 GetAttributeVersion(const FLuxAttribute& Attribute) const;
+
 	/** 속성 값 변경이 가능한지 미리 확인합니다. */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "LuxActionSystem|Attributes")
 	bool CanApplyAttributeModifiers(const TArray<FAttributeModifier>& Modifiers, FGameplayTagContainer& OutFailureTags) const;
@@ -467,7 +589,19 @@ protected:
 	/** 모든 부여된 Attribute들의 CurrentValue를 재계산합니다. */
 	void RecalculateAllCurrentAttributeValues();
 
+	/** 지속 효과로 인해 재계산이 필요한 속성을 표시합니다. 지연 모드가 아니면 즉시 재계산합니다. */
+	void MarkAttributeDirty(const FLuxAttribute& Attribute);
+
 	void SetSpawnedAttributesDirty();
+
+	/** 활성 효과의 Modifier 들을 속성별 집계기에 등록합니다. */
+	void AddEffectToAggregators(const FActiveLuxEffect& ActiveEffect);
+
+	/** 활성 효과의 Modifier 들을 속성별 집계기에서 제거합니다. */
+	void RemoveEffectFromAggregators(const FActiveLuxEffect& ActiveEffect);
+
+	/** 활성 효과의 스택 변경을 속성별 집계기에 반영합니다. */
+	void UpdateEffectStacksInAggregators(const FActiveLuxEffect& ActiveEffect);
 #pragma endregion
 
 
@@ -489,6 +623,9 @@ public:
 	/** 입력 태그가 떼어졌을 때 호출됩니다. */
 	void ActionInputTagReleased(FGameplayTag InputTag);
 
+	/** 입력 구성이 적용될 때 호출되어 입력 태그별 라우팅 테이블을 구성합니다. */
+	void InitializeInputRouting(const ULuxInputConfig* InputConfig);
+
 	/** 현재 모든 입력을 초기화합니다. */
 	void ClearActionInput();
 
@@ -514,6 +651,15 @@ protected:
 
 	/** 매 틱마다 지속적인 입력을 처리합니다. */
 	void ProcessActionInput(float DeltaTime, bool bGamePaused);
+
+	/** Spec 목록으로부터 라우팅 테이블의 핸들 목록을 다시 채웁니다. (InputHandlesLock 쓰기 락 필요) */
+	void RebuildInputRouting_Locked();
+
+	/** 입력 태그 → 라우팅 정보. 입력 처리 시 Spec 전체 순회 대신 사용합니다. (InputHandlesLock 으로 보호) */
+	TMap<FGameplayTag, FLuxInputRoute> InputRoutes;
+
+	/** Spec 이 부여/제거되거나 입력 태그가 바뀌어 라우팅 테이블을 다시 채워야 하는지 여부 (입력 락 없이 표시할 수 있도록 원자적) */
+	FThreadSafeBool bInputRoutesDirty = true;
 #pragma endregion
 
 
@@ -560,17 +706,41 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Lux|Tags")
 	bool HasAll(const FGameplayTagContainer& TagContainer) const;
 
+	/** 미리 컴파일된 태그 질의(All/Any/None)를 현재 태그가 만족하는지 확인합니다. */
+	bool MatchesTagQuery(const FLuxCompiledTagQuery& Query) const;
+
 	/** 지정된 태그의 현재 스택 수를 반환합니다. (없으면 0) */
 	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Tags")
 	int32 GetTagStackCount(const FGameplayTag& Tag) const;
 
 	/** 컨테이너가 가진 모든 태그를 FGameplayTagContainer 형태로 반환합니다. */
 	UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Tags")
-	FGameplayTagContainer GetGameplayTags() const;
+	const FGameplayTagContainer& GetGameplayTags() const;
+
+	/** 보유 태그 집합의 버전을 반환합니다. 이전에 저장한 값과 같다면 태그 기반 재평가를 건너뛸 수 있습니다. */
+	uint32 GetGameplayTagsVersion() const { return GrantedTags.GetTagsVersion(); }
+
+	/** 보유 태그 스택 컨테이너의 복제 대역폭 누적 통계를 반환합니다. ('Lux.Net.DumpTagStackStats' 로 출력) */
+	const FGameplayTagStackNetStats& GetGameplayTagsNetStats() const { return GrantedTags.GetNetStats(); }
 
 	/** 이 컴포넌트의 게임플레이 태그 스택 수가 변경될 때마다 호출됩니다. */
 	UPROPERTY(BlueprintAssignable, Category = "LuxActionSystem|Tags")
 	FOnGameplayTagStackChanged OnGameplayTagStackChanged;
+
+	/**
+	 * 특정 태그(자식 태그 포함)의 스택 수 변경을 구독합니다.
+	 * 알림은 틱마다 태그별로 한 번, 순 변화가 있을 때만 전달됩니다.
+	 */
+	FOnGameplayTagCountChangedNative& RegisterGameplayTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType = ELuxTagEventType::NewOrRemoved);
+
+	/** RegisterGameplayTagEvent 로 등록한 구독을 해제합니다. */
+	void UnregisterGameplayTagEvent(FDelegateHandle DelegateHandle, const FGameplayTag& Tag, ELuxTagEventType EventType = ELuxTagEventType::NewOrRemoved);
+
+	/**
+	 * 보유 태그 집합이 바뀌었다면 State.Block.Movement 보유 여부를 아바타의 이동 컴포넌트에 바로 전달합니다.
+	 * 태그를 바꾸는 경로(서버의 AddTag/RemoveTag, 클라이언트의 복제 수신)에서 동기적으로 호출됩니다.
+	 */
+	void RefreshMovementBlocked();
 #pragma endregion
 
 
@@ -594,9 +764,30 @@ public:
     /** 이벤트 발생 시 구독자들에게만 전달 */
     void BroadcastGameplayEventToSubscribers(const FGameplayTag& EventTag, const FContextPayload& Payload);
 
+	/** 마지막 시작/정지 시점에 기록된 아바타의 이동 상태를 반환합니다. (bIsMoving 만 항상 최신입니다.) */
+	const FLuxMovementState& GetMovementState() const { return MovementState; }
+
+	/** 움직임이 시작되거나 멈출 때만 호출되는 네이티브 델리게이트입니다. */
+	FOnMovementStateChangedNative OnMovementStateChangedNative;
+
 private:
+	/** 이동 상태를 갱신합니다. Event.Movement.Started 는 움직이는 동안 매 틱, Stopped 는 멈춘 프레임에만 구독자가 있을 때 발생시킵니다. */
+	void UpdateMovementState(const UCharacterMovementComponent& MovementComponent);
+
+	/** 아바타의 이동 컴포넌트를 캐시하고 현재 이동 차단 상태를 전달합니다. */
+	void BindMovementModifierState();
+
+	/** 이동 차단 상태를 전달받는 아바타의 이동 컴포넌트 */
+	TWeakObjectPtr<ULuxCharacterMovementComponent> LuxMovementComponent;
+
+	/** 마지막으로 이동 차단 상태를 전달했을 때의 보유 태그 집합 버전 */
+	uint32 MovementBlockTagsVersion = 0;
+
 	/** 이벤트별 구독자 델리게이트: EventTag -> 델리게이트 */
     TMap<FGameplayTag, FOnGameplayEvent> EventSubscriptions;
+
+	/** 마지막으로 관측된 이동 상태 */
+	FLuxMovementState MovementState;
 #pragma endregion
 
 
@@ -616,6 +807,21 @@ public:
 	UPROPERTY()
 	TObjectPtr<ULuxActionTagRelationshipMapping> TagRelationshipMapping;
 
+	/**
+	 * true 이면 지속/무한 효과로 인한 CurrentValue 재계산을 프레임 끝(TickComponent)까지 미루고 속성당 한 번만 수행합니다.
+	 * 플러시 전까지 GetNumericAttribute 등은 이전 값을 반환하므로, 즉시 값이 필요하면 FlushDirtyAttributes 를 호출하세요.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "LuxActionSystem|Attributes")
+	bool bDeferAttributeRecalculation = false;
+
+	/**
+	 * true 이면 클라이언트의 액션 활성화 요청, 입력 이벤트, 태스크 이벤트를 한 프레임 동안 모아 하나의 Reliable RPC 로 보냅니다.
+	 * 요청 순서와 예측 키는 그대로 유지되며, 서버는 번들을 풀어 기존 핸들러를 순서대로 호출합니다.
+	 * 번들 밖의 서버 RPC 는 보내기 전에 번들을 먼저 플러시하므로 이 컴포넌트의 서버 RPC 간 순서도 바뀌지 않습니다.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "LuxActionSystem|Network")
+	bool bBundleServerRPCs = true;
+
 #pragma endregion
 
 #pragma region Core State Containers (Replicated)
@@ -648,19 +854,26 @@ protected:
 //	friend struct FActiveLuxActionContainer;
 //	friend struct FActiveLuxEffectsContainer;
 //
-//	/** FLuxActionSpec 포인터를 직접 찾기 위한 맵. (O(1) 조회용) */
-//	TMap<FLuxActionSpecHandle, FLuxActionSpec*> ActionSpecMap;
-//
 //	/** FActiveLuxAction 포인터를 직접 찾기 위한 맵. */
 //	TMap<FActiveLuxActionHandle, FActiveLuxAction*> ActiveActionMap;
-//
-//	/** FActiveLuxEffect 포인터를 직접 찾기 위한 맵. */
-//	TMap<FActiveLuxEffectHandle, FActiveLuxEffect*> ActiveEffectMap;
 
+	// FLuxActionSpec 과 FActiveLuxEffect 는 각 컨테이너의 HandleIndex 를 통해 O(1) 로 조회합니다.
 	friend struct FActionSpecContainer;
 
 	/** 해당 이벤트를 트리거로 사용하는 액션 핸들 목록을 저장하는 맵. (O(1) 조회용) */
 	TMap<FGameplayTag, TArray<FLuxActionSpecHandle>> EventTriggerMap;
+
+	/** 속성별 지속 효과 Modifier 집계기. CurrentValue 재계산 시 전체 이펙트 순회 대신 사용합니다. (서버 전용) */
+	TMap<FLuxAttribute, FLuxAttributeAggregator> AttributeAggregators;
+
+	/** 다음 플러시 때 재계산할 속성 목록 (더티로 표시된 순서 유지) */
+	TArray<FLuxAttribute> DirtyAttributes;
+
+	/** 속성 레지스트리 ID 로 색인되는 속성별 값 버전 */
+	TArray<uint32> AttributeVersions;
+
+	/** 액션 Spec 별 활성화 판정 캐시. 추가 비용(AdditionalCosts)이 있는 액션은 외부 상태에 의존하므로 캐시하지 않습니다. */
+	mutable TMap<FLuxActionSpecHandle, FLuxActivationVerdict> ActivationVerdicts;
 #pragma endregion
 
 #pragma region Input Handling
@@ -688,18 +901,34 @@ private:
 	UPROPERTY()
 	TMap<FLuxPredictionKey, FGameplayTag> PendingCues;
 
+	/** 이번 프레임에 서버로 보낼 요청들입니다. (HandleWorldPostActorTick 에서 전송) */
+	FLuxServerRPCBundle PendingServerRPCBundle;
+
+	/** 번들이 비어 있지 않을 때만 등록되는 OnWorldPostActorTick 핸들입니다. */
+	FDelegateHandle ServerRPCBundleFlushHandle;
+
 	/** 다음 예측에 사용할 키 ID입니다. */
 	int32 NextPredictionKeyId = 1;
 
 #pragma endregion
 
 #pragma region Timer Management
+public:
+	/** 이펙트 스케줄러의 예약/실행 통계를 반환합니다. */
+	const FLuxEffectSchedulerStats& GetEffectSchedulerStats() const { return EffectScheduler.GetStats(); }
+
 private:
-	/** 활성 이펙트의 만료 타이머를 관리하는 맵입니다. */
-	TMap<FActiveLuxEffectHandle, FTimerHandle> ExpirationTimerMap;
+	/** 이번 프레임에 실행 시각에 도달한 이펙트 만료 및 주기 이벤트를 처리합니다. */
+	void ProcessScheduledEffects();
+
+	/** 현재 LuxActionSpecs 로 새 스냅샷을 만들어 발행합니다. Spec 이 부여/제거되거나 레벨/입력 태그가 바뀔 때만 호출됩니다. */
+	void PublishActionSpecSnapshot();
 
-	/** 활성 이펙트의 주기적인(Periodic) 실행 타이머를 관리하는 맵입니다. */
-	TMap<FActiveLuxEffectHandle, FTimerHandle> PeriodTimerMap;
+	/** 활성 이펙트의 만료와 주기적인(Periodic) 실행을 관리하는 스케줄러입니다. */
+	FLuxEffectScheduler EffectScheduler;
+
+	/** ProcessScheduledEffects 에서 재사용하는 버퍼입니다. */
+	TArray<FLuxScheduledEffectFire> FiredEffectEvents;
 #pragma endregion
 
 
@@ -712,9 +941,13 @@ private:
 	mutable FRWLock ActiveLuxEffectsLock;
 	mutable FRWLock InputHandlesLock;
 
+	/** ActionSpecSnapshot 포인터 교체만 보호하는 락입니다. */
+	mutable FRWLock ActionSpecSnapshotLock;
+
+	/** 마지막으로 발행된 ActionSpec 스냅샷 */
+	FLuxActionSpecSnapshotPtr ActionSpecSnapshot;
+
 #pragma endregion
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<ULuxAction>> PendingKillActions;
-
-	bool bIsMoving = false;
 };
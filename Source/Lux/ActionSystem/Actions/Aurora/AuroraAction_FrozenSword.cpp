@@ -354,7 +354,7 @@ void UAuroraAction_FrozenSword::PhaseProcessHit(UActionSystemComponent& SourceAS
 	}
 
 	// 서버의 OnHitPredicted 함수가 ActionPayload에 저장해 둔 타격 정보를 가져옵니다.
-	const FPayload_HitData* HitData = ActionPayload->GetData<FPayload_HitData>(FName("HitData"));
+	const FPayload_HitData* HitData = ActionPayload->GetData<FPayload_HitData>(LuxPayloadKeys::HitData);
 	if (!HitData)
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("[%s][%s] 서버 타격 정보가 유효하지 않습니다."), *GetLogPrefix(), ANSI_TO_TCHAR(__FUNCTION__));
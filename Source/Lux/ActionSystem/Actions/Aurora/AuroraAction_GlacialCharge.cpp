@@ -321,7 +321,7 @@ void UAuroraAction_GlacialCharge::DashServer(UActionSystemComponent& SourceASC)
 	FRotator OrginRotation = AvatarActor->GetActorRotation();
 
 	// 이전 'Analyze' 페이즈에서 생성된 경로 데이터를 가져옵니다.
-	const FPayload_PathData* PathData = ActionPayload->GetData<FPayload_PathData>(FName("PathData"));
+	const FPayload_PathData* PathData = ActionPayload->GetData<FPayload_PathData>(LuxPayloadKeys::PathData);
 	if (!PathData || PathData->PathPoints.Num() < 2)
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("PhaseDash 실패: ActionPayload에서 유효한 경로 데이터를 찾을 수 없습니다."));
@@ -147,10 +147,20 @@ ENetRole ULuxAction::GetNetRole() const
 
 int32 ULuxAction::GetActionLevel() const
 {
-	// ASC에서 ActiveAction 데이터를 먼저 검색합니다.
 	UActionSystemComponent* ASC = GetActionSystemComponent();
 	if (ASC)
 	{
+		// 락과 선형 탐색 없이 스냅샷에서 Spec 레벨을 읽습니다. (예측 실행 중에도 유효)
+		if (ActiveSpecHandle.IsValid())
+		{
+			const FLuxActionSpecSnapshotPtr Snapshot = ASC->GetActionSpecSnapshot();
+			if (const FLuxActionSpecSnapshotEntry* SnapshotEntry = Snapshot.IsValid() ? Snapshot->Find(ActiveSpecHandle) : nullptr)
+			{
+				return SnapshotEntry->Level;
+			}
+		}
+
+		// 리플리케이션으로 받은 인스턴스처럼 Spec 핸들을 모르는 경우 ActiveAction 데이터를 검색합니다.
 		if (const FActiveLuxAction* FoundAction = ASC->FindActiveAction(GetActiveHandle()))
 		{
 			return FoundAction->Spec.Level;
@@ -160,7 +170,7 @@ int32 ULuxAction::GetActionLevel() const
 	// 실패 시 (예측 클라이언트인 경우), ActionPayload에서 Spec 데이터를 찾아 레벨을 반환합니다.
 	if (ActionPayload.IsValid())
 	{
-		if (const FLuxActionSpec* SpecFromPayload = ActionPayload->GetData<FLuxActionSpec>(FName("ActionSpec")))
+		if (const FLuxActionSpec* SpecFromPayload = ActionPayload->GetData<FLuxActionSpec>(LuxPayloadKeys::ActionSpec))
 		{
 			return SpecFromPayload->Level;
 		}
@@ -180,6 +190,16 @@ FActiveLuxAction* ULuxAction::GetActiveActionStruct() const
 	return ASC->FindActiveAction(GetActiveHandle());
 }
 
+const FLuxCompiledTagQuery& ULuxAction::GetActivationRequiredQuery() const
+{
+	return ActivationRequiredQuery.GetOrCompile(ActivationRequiredTags, FGameplayTagContainer::EmptyContainer, FGameplayTagContainer::EmptyContainer);
+}
+
+const FLuxCompiledTagQuery& ULuxAction::GetActivationBlockedQuery() const
+{
+	return ActivationBlockedQuery.GetOrCompile(FGameplayTagContainer::EmptyContainer, FGameplayTagContainer::EmptyContainer, ActivationBlockedTags);
+}
+
 FLuxActionSpec* ULuxAction::GetLuxActionSpec()
 {
 	UActionSystemComponent* ASC = GetActionSystemComponent();
@@ -306,6 +326,7 @@ void ULuxAction::ExecuteAction(const FOwningActorInfo& ActorInfo, const FLuxActi
 
 	OwningActorInfo = ActorInfo;
 	ActiveActionHandle = ActiveAction;
+	ActiveSpecHandle = Spec.Handle;
 	LifecycleState = ELuxActionLifecycleState::Executing;
 
 	if (::IsValid(ActionPhaseData) && ActionPhaseData->Phases.Num() > 0)
@@ -970,7 +991,7 @@ void ULuxAction::NotifyTaskEventToServer(const FGameplayTag& EventTag, const FCo
 	UActionSystemComponent* ASC = GetActionSystemComponent();
 	if (!ASC) return;
 
-	ASC->Server_ReceiveTaskEvent(GetActiveHandle(), EventTag, Payload);
+	ASC->SendTaskEventToServer(GetActiveHandle(), EventTag, Payload);
 }
 
 void ULuxAction::AddTaskResultStoreRequest(const FGameplayTag& EventTag, FName SourceKey, FName DestinationKey)
@@ -1003,11 +1024,7 @@ void ULuxAction::HandleTaskResultStoringEvent(const FGameplayTag& EventTag, cons
 
 	for (const FTaskResultStoreRequest& Request : *Requests)
 	{
-		if (const FInstancedStruct* SourceData = Payload.GetData<FInstancedStruct>(Request.SourceKey))
-		{
-			ActionPayload->DataArray.Add(*SourceData);
-			ActionPayload->DataKeys.Add(Request.DestinationKey);
-		}
+		ActionPayload->CopyDataFrom(Payload, Request.SourceKey, Request.DestinationKey);
 	}
 }
 
@@ -144,15 +144,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "LuxAction|Network")
 	ENetRole GetNetRole() const;
 
-	/** 현재 실행 중인 액션의 레벨을 가져옵니다. 서버/클라이언트에 따라 ASC 또는 ActionPayload에서 데이터를 찾습니다. */
+	/** 현재 실행 중인 액션의 레벨을 가져옵니다. ActionSpec 스냅샷을 먼저 확인하고, 없으면 ASC 또는 ActionPayload에서 데이터를 찾습니다. */
 	UFUNCTION(BlueprintCallable, Category = "LuxAction")
 	int32 GetActionLevel() const;
 
+	/** 현재 실행 중인 Spec 의 핸들을 반환합니다. 실행 중이 아니면 유효하지 않은 핸들입니다. */
+	FLuxActionSpecHandle GetActiveSpecHandle() const { return ActiveSpecHandle; }
+
 	/** 이 액션 인스턴스에 해당하는 FActiveLuxAction 구조체 포인터를 반환합니다. 액션의 활성 상태 정보에 접근할 수 있습니다. */
 	FActiveLuxAction* GetActiveActionStruct() const;
 
 	/** 이 액션의 원본 FLuxActionSpec 포인터를 반환합니다. 액션의 영구 데이터(설정, 태그 등)에 접근할 수 있습니다. */
 	FLuxActionSpec* GetLuxActionSpec();
+
+	/** ActivationRequiredTags 를 컴파일한 질의를 반환합니다. (최초 호출 시 한 번만 컴파일됩니다.) */
+	const FLuxCompiledTagQuery& GetActivationRequiredQuery() const;
+
+	/** ActivationBlockedTags 를 컴파일한 질의를 반환합니다. (최초 호출 시 한 번만 컴파일됩니다.) */
+	const FLuxCompiledTagQuery& GetActivationBlockedQuery() const;
 #pragma endregion
 
 #pragma region Action Lifecycle Management
@@ -504,12 +513,19 @@ protected:
 	UPROPERTY(Replicated)
 	FActiveLuxActionHandle ActiveActionHandle;
 
+	/** 현재 실행 중인 Spec 의 핸들입니다. ActiveActionHandle 과 달리 예측 실행 중에도 유효하여 스냅샷 조회에 사용합니다. */
+	FLuxActionSpecHandle ActiveSpecHandle;
+
 	/** 이 액션의 페이즈에 의해 활성화된 카메라 모드들의 스택입니다. 액션별 카메라 제어를 관리합니다. */
 	UPROPERTY(Transient)
 	TArray<TSubclassOf<ULuxCameraMode>> PushedCameraModes;
 
 	/** 이벤트 핸들러 맵에 대한 동시 접근을 막기 위한 크리티컬 섹션입니다. 스레드 안전성을 보장합니다. */
 	mutable FCriticalSection EventHandlersCS;
+
+	/** 활성화 태그 조건을 컴파일한 질의 캐시입니다. 태그 조건은 에셋 데이터이므로 한 번만 컴파일합니다. */
+	FLuxCompiledTagQuery ActivationRequiredQuery;
+	FLuxCompiledTagQuery ActivationBlockedQuery;
 #pragma endregion
 
 #pragma region UI & Display Data
@@ -149,8 +149,14 @@ void FLuxActionSpec::PostReplicatedChange(const struct FActionSpecContainer& InA
 	// UE_LOG(LogTemp, Log, TEXT("FLuxActionSpec::PostReplicatedChange - Action: %s"), Action ? *Action->GetName() : TEXT("NULL"));
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+
 void FActionSpecContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
 {
+	// 추가된 항목은 제거로 인해 당겨진 인덱스 뒤에 붙을 수 있으므로 수신 완료 시점에 색인을 다시 구성합니다.
+	HandleIndex.MarkDirty();
+	bSnapshotStale = true;
+
 	if (!OwnerComponent.IsValid())
 		return;
 
@@ -161,7 +167,6 @@ void FActionSpecContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndic
 
 		UE_LOG(LogLuxActionSystem, Log, TEXT("[Client] ActionSpec Added: '%s'"), *AddedSpec.Action->GetName());
 
-		//OwnerComponent->ActionSpecMap.Add(AddedSpec.Handle, &AddedSpec);
 		for (const FGameplayTag& TriggerTag : AddedSpec.Action->EventTriggerTags)
 		{
 			OwnerComponent->EventTriggerMap.FindOrAdd(TriggerTag).Add(AddedSpec.Handle);
@@ -172,11 +177,25 @@ void FActionSpecContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndic
 void FActionSpecContainer::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize)
 {
 	if (!OwnerComponent.IsValid())
+	{
+		bSnapshotStale = true;
 		return;
+	}
+
+	// 활성화마다 ActivationCount / LastExecutionTime / DynamicTags 가 바뀌어 변경이 수신되므로,
+	// 스냅샷에 담긴 값이 실제로 바뀐 경우에만 다시 발행합니다.
+	const FLuxActionSpecSnapshotPtr Snapshot = OwnerComponent->GetActionSpecSnapshot();
 
 	for (const int32 Index : ChangedIndices)
 	{
 		FLuxActionSpec& ChangedSpec = Items[Index];
+
+		const FLuxActionSpecSnapshotEntry* SnapshotEntry = Snapshot.IsValid() ? Snapshot->Find(ChangedSpec.Handle) : nullptr;
+		if (!SnapshotEntry || !SnapshotEntry->MatchesSpec(ChangedSpec))
+		{
+			bSnapshotStale = true;
+		}
+
 		if (!ChangedSpec.Action) continue;
 
 		UE_LOG(LogLuxActionSystem, Log, TEXT("[Client] ActionSpec Changed: '%s'"), *ChangedSpec.Action->GetName());
@@ -185,6 +204,10 @@ void FActionSpecContainer::PostReplicatedChange(const TArrayView<int32>& Changed
 
 void FActionSpecContainer::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
 {
+	// 제거 직후 FastArray 가 항목을 RemoveAtSwap 으로 재배치하므로 수신 완료 시점에 색인을 다시 구성합니다.
+	HandleIndex.MarkDirty();
+	bSnapshotStale = true;
+
 	if (!OwnerComponent.IsValid())
 		return;
 
@@ -196,7 +219,6 @@ void FActionSpecContainer::PreReplicatedRemove(const TArrayView<int32>& RemovedI
 
 		UE_LOG(LogLuxActionSystem, Log, TEXT("[Client] ActionSpec Removed: '%s'"), *RemovedSpec.Action->GetName());
 
-		//OwnerComponent->ActionSpecMap.Remove(RemovedSpec.Handle);
 		for (const FGameplayTag& TriggerTag : RemovedSpec.Action->EventTriggerTags)
 		{
 			if (TArray<FLuxActionSpecHandle>* Handles = OwnerComponent->EventTriggerMap.Find(TriggerTag))
@@ -207,6 +229,84 @@ void FActionSpecContainer::PreReplicatedRemove(const TArrayView<int32>& RemovedI
 	}
 }
 
+void FActionSpecContainer::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (HandleIndex.IsDirty())
+	{
+		if (OwnerComponent.IsValid())
+		{
+			FRWScopeLock WriteLock(OwnerComponent->ActionSpecsLock, FRWScopeLockType::SLT_Write);
+			HandleIndex.Rebuild(Items, [](const FLuxActionSpec& Spec) { return Spec.Handle.Handle; });
+		}
+		else
+		{
+			HandleIndex.Rebuild(Items, [](const FLuxActionSpec& Spec) { return Spec.Handle.Handle; });
+		}
+	}
+
+	// 한 번의 수신에서 여러 항목이 바뀌어도 스냅샷은 한 번만 발행합니다.
+	if (bSnapshotStale && OwnerComponent.IsValid())
+	{
+		bSnapshotStale = false;
+		OwnerComponent->PublishActionSpecSnapshot();
+	}
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+FLuxActionSpecSnapshotEntry::FLuxActionSpecSnapshotEntry(const FLuxActionSpec& Spec)
+	: Handle(Spec.Handle)
+	, Action(Spec.Action)
+	, InputTag(Spec.InputTag)
+	, ActionIdentifierTag(Spec.ActionIdentifierTag)
+	, CooldownTag(Spec.GetCooldownTag())
+	, Level(Spec.Level)
+{
+	if (Spec.Action)
+	{
+		ActionTags = Spec.Action->ActionTags;
+	}
+}
+
+bool FLuxActionSpecSnapshotEntry::MatchesSpec(const FLuxActionSpec& Spec) const
+{
+	return Handle == Spec.Handle
+		&& Action.Get() == Spec.Action
+		&& InputTag == Spec.InputTag
+		&& ActionIdentifierTag == Spec.ActionIdentifierTag
+		&& Level == Spec.Level;
+}
+
+const FLuxActionSpecSnapshotEntry* FLuxActionSpecSnapshot::Find(FLuxActionSpecHandle SpecHandle) const
+{
+	const int32 SpecIndex = HandleIndex.Find(SpecHandle.Handle);
+	return Specs.IsValidIndex(SpecIndex) ? &Specs[SpecIndex] : nullptr;
+}
+
+bool FLuxActionSpecSnapshot::HasSameInputRouting(const FLuxActionSpecSnapshot& Other) const
+{
+	if (Specs.Num() != Other.Specs.Num())
+	{
+		return false;
+	}
+
+	// 라우팅 테이블은 Spec 순서대로 채워지므로 순서까지 같아야 동일한 것으로 봅니다.
+	for (int32 Index = 0; Index < Specs.Num(); ++Index)
+	{
+		const FLuxActionSpecSnapshotEntry& Entry = Specs[Index];
+		const FLuxActionSpecSnapshotEntry& OtherEntry = Other.Specs[Index];
+		if (!(Entry.Handle == OtherEntry.Handle)
+			|| Entry.Action.IsValid() != OtherEntry.Action.IsValid()
+			|| Entry.InputTag != OtherEntry.InputTag
+			|| Entry.ActionTags != OtherEntry.ActionTags)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 FActiveLuxActionHandle::FActiveLuxActionHandle()
@@ -376,4 +476,77 @@ void FActiveLuxActionContainer::PreReplicatedRemove(const TArrayView<int32>& Rem
 			UE_LOG(LogLuxActionSystem, Log, TEXT("클라이언트: 활성 액션 '%s'가 제거됩니다."), *Action->GetName());
 		}
 	}
-}
\ No newline at end of file
+}
+
+bool FLuxServerRPCBundleEntry::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint8 TypeValue = static_cast<uint8>(Type);
+	Ar.SerializeBits(&TypeValue, 2);
+	if (Ar.IsLoading())
+	{
+		TypeValue &= 0x3;
+		if (TypeValue > static_cast<uint8>(ELuxServerRPCType::ReplicatedEvent))
+		{
+			bOutSuccess = false;
+			return false;
+		}
+		Type = static_cast<ELuxServerRPCType>(TypeValue);
+	}
+
+	if (Type == ELuxServerRPCType::TryExecuteAction)
+	{
+		SpecHandle.NetSerialize(Ar, Map, bOutSuccess);
+		Ar << PredictionKey.Key;
+		return bOutSuccess;
+	}
+
+	if (Type == ELuxServerRPCType::ReplicatedEvent)
+	{
+		SpecHandle.NetSerialize(Ar, Map, bOutSuccess);
+
+		uint8 EventValue = static_cast<uint8>(ReplicatedEvent);
+		Ar.SerializeBits(&EventValue, 2);
+		ReplicatedEvent = static_cast<EActionReplicatedEvent>(EventValue & 0x3);
+		return bOutSuccess;
+	}
+
+	Ar << ActionHandle.Handle;
+
+	EventTag.NetSerialize(Ar, Map, bOutSuccess);
+	if (!bOutSuccess) return false;
+
+	return Payload.NetSerialize(Ar, Map, bOutSuccess);
+}
+
+bool FLuxServerRPCBundle::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	bOutSuccess = true;
+
+	uint32 NumEntries = static_cast<uint32>(Entries.Num());
+	Ar.SerializeIntPacked(NumEntries);
+
+	if (Ar.IsLoading())
+	{
+		if (NumEntries > static_cast<uint32>(MaxEntries))
+		{
+			bOutSuccess = false;
+			return false;
+		}
+
+		Entries.Reset();
+		Entries.SetNum(NumEntries);
+	}
+
+	// 서버가 클라이언트에서 발생한 순서 그대로 처리하도록 배열 순서를 유지합니다.
+	for (FLuxServerRPCBundleEntry& Entry : Entries)
+	{
+		if (!Entry.NetSerialize(Ar, Map, bOutSuccess))
+		{
+			return false;
+		}
+	}
+
+	return bOutSuccess;
+}
@@ -278,6 +278,7 @@ public:
 	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
 	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
 	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
 	{
@@ -289,8 +290,68 @@ public:
 
 	UPROPERTY(Transient)
 	TWeakObjectPtr<UActionSystemComponent> OwnerComponent;
+
+	/** 핸들 -> Items 인덱스 색인 (리플리케이션되지 않음) */
+	FLuxHandleSparseIndex HandleIndex;
+
+	/** 리플리케이션 수신으로 Spec 이 추가/변경/제거되어 스냅샷을 다시 발행해야 하는지 여부 */
+	bool bSnapshotStale = false;
+};
+
+
+/**
+ * @struct FLuxActionSpecSnapshotEntry
+ * @brief 스냅샷에 담기는 Spec 하나의 읽기 전용 사본입니다.
+ * 부여/제거/레벨 변경 때만 바뀌는 값만 담고, ActivationCount / LastExecutionTime / DynamicTags 처럼 실행마다 바뀌는 값은 담지 않습니다.
+ */
+struct LUX_API FLuxActionSpecSnapshotEntry
+{
+	explicit FLuxActionSpecSnapshotEntry(const FLuxActionSpec& Spec);
+
+	/** Spec 의 스냅샷 대상 값이 이 사본과 같은지 확인합니다. */
+	bool MatchesSpec(const FLuxActionSpec& Spec) const;
+
+	FLuxActionSpecHandle Handle;
+
+	/** 액션 CDO 또는 인스턴스. GC 를 막지 않으며, 게임 스레드 밖에서는 아래의 일반 데이터만 읽습니다. */
+	TWeakObjectPtr<ULuxAction> Action;
+
+	FGameplayTag InputTag;
+	FGameplayTag ActionIdentifierTag;
+
+	/** 액션의 ActionTags 사본 */
+	FGameplayTagContainer ActionTags;
+
+	/** 발행 시점에 InputTag 로부터 계산해 둔 쿨다운 태그 */
+	FGameplayTag CooldownTag;
+
+	int32 Level = 1;
 };
 
+/**
+ * @struct FLuxActionSpecSnapshot
+ * @brief 부여된 ActionSpec 목록의 불변(Immutable) 스냅샷입니다.
+ * Spec 이 부여/제거되거나 레벨/입력 태그가 바뀔 때만 새로 발행되며, 발행 이후에는 수정되지 않으므로 어떤 스레드에서든 락 없이 읽을 수 있습니다.
+ */
+struct LUX_API FLuxActionSpecSnapshot
+{
+	/** 발행될 때마다 1씩 증가하는 버전 */
+	uint32 Version = 0;
+
+	TArray<FLuxActionSpecSnapshotEntry> Specs;
+
+	/** 핸들 -> Specs 인덱스 색인 */
+	FLuxHandleSparseIndex HandleIndex;
+
+	/** 핸들로 Spec 을 검색합니다. */
+	const FLuxActionSpecSnapshotEntry* Find(FLuxActionSpecHandle SpecHandle) const;
+
+	/** 두 스냅샷의 Spec 구성과 입력 라우팅에 쓰이는 태그(InputTag, ActionTags)가 같은지 확인합니다. */
+	bool HasSameInputRouting(const FLuxActionSpecSnapshot& Other) const;
+};
+
+using FLuxActionSpecSnapshotPtr = TSharedPtr<const FLuxActionSpecSnapshot, ESPMode::ThreadSafe>;
+
 
 USTRUCT()
 struct FActiveLuxActionContainer : public FFastArraySerializer
@@ -315,6 +376,69 @@ public:
 };
 
 
+
+/** 번들 RPC 에 담겨 서버로 전송되는 요청의 종류입니다. */
+UENUM()
+enum class ELuxServerRPCType : uint8
+{
+	/** Server_TryExecuteAction 과 동일한 액션 활성화 요청 */
+	TryExecuteAction,
+
+	/** Server_ReceiveTaskEvent 와 동일한 태스크 이벤트 */
+	TaskEvent,
+
+	/** ServerInvokeReplicatedEvent 와 동일한 입력 눌림/뗌 이벤트 */
+	ReplicatedEvent,
+};
+
+/**
+ * @struct FLuxServerRPCBundleEntry
+ * @brief 번들에 담긴 단일 요청입니다. 종류에 따라 필요한 필드만 직렬화합니다.
+ */
+USTRUCT()
+struct FLuxServerRPCBundleEntry
+{
+	GENERATED_BODY()
+
+public:
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+public:
+	ELuxServerRPCType Type = ELuxServerRPCType::TryExecuteAction;
+
+	/** TryExecuteAction: 실행할 액션 Spec 핸들과 클라이언트 예측 키 (ReplicatedEvent 도 SpecHandle 을 사용) */
+	FLuxActionSpecHandle SpecHandle;
+	FLuxPredictionKey PredictionKey;
+
+	/** ReplicatedEvent: 서버에 알릴 입력 이벤트 종류 */
+	EActionReplicatedEvent ReplicatedEvent = EActionReplicatedEvent::None;
+
+	/** TaskEvent: 이벤트를 받을 활성 액션 핸들과 이벤트 태그, 페이로드 */
+	FActiveLuxActionHandle ActionHandle;
+	FGameplayTag EventTag;
+	FContextPayload Payload;
+};
+
+/**
+ * @struct FLuxServerRPCBundle
+ * @brief 한 프레임 동안 클라이언트에서 발생한 서버 요청들을 발생 순서대로 묶어 하나의 RPC 로 보냅니다.
+ */
+USTRUCT()
+struct FLuxServerRPCBundle
+{
+	GENERATED_BODY()
+
+public:
+	/** 한 번들에 담을 수 있는 최대 요청 수. 넘치면 그 즉시 번들을 전송합니다. */
+	static constexpr int32 MaxEntries = 32;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+public:
+	TArray<FLuxServerRPCBundleEntry, TInlineAllocator<4>> Entries;
+};
+
+
 template<>
 struct TStructOpsTypeTraits<FLuxActionSpec> : public TStructOpsTypeTraitsBase2<FLuxActionSpec>
 {
@@ -333,6 +457,18 @@ struct TStructOpsTypeTraits<FActionSpecContainer> : public TStructOpsTypeTraitsB
 	enum { WithNetDeltaSerializer = true };
 };
 
+template<>
+struct TStructOpsTypeTraits<FLuxServerRPCBundleEntry> : public TStructOpsTypeTraitsBase2<FLuxServerRPCBundleEntry>
+{
+	enum { WithNetSerializer = true };
+};
+
+template<>
+struct TStructOpsTypeTraits<FLuxServerRPCBundle> : public TStructOpsTypeTraitsBase2<FLuxServerRPCBundle>
+{
+	enum { WithNetSerializer = true };
+};
+
 template<>
 struct TStructOpsTypeTraits<FActiveLuxActionContainer> : public TStructOpsTypeTraitsBase2<FActiveLuxActionContainer>
 {
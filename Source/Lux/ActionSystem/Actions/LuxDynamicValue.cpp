@@ -19,15 +19,15 @@ FVector FDynamicVector::GetValue(ULuxAction* InAction) const
 	/** =============== 'FromLevelData'인 경우 =============== */
 	if (Source == EPhaseParameterSource::FromLevelData)
 	{
-		// ASC 를 통해 FActiveLuxAction 검색합니다.
-		const FActiveLuxAction* ActiveAction = InAction->GetActionSystemComponent()->FindActiveAction(InAction->GetActiveHandle());
-		if (!InAction->LevelDataTable || !ActiveAction || DataKey.IsNone())
+		if (!InAction->LevelDataTable || DataKey.IsNone())
 		{
 			return StaticValue;
 		}
 
+		const int32 ActionLevel = InAction->GetActionLevel();
+
 		// LevelDataTable 에서 액션 레벨에 해당하는 FLuxActionLevelData 을 검색합니다.
-		const FName RowName = FName(*FString::FromInt(ActiveAction->Spec.Level));
+		const FName RowName = FName(*FString::FromInt(ActionLevel));
 		const FLuxActionLevelData* LevelData = InAction->LevelDataTable->FindRow<FLuxActionLevelData>(RowName, TEXT(""));
 		if (!LevelData)
 		{
@@ -85,15 +85,15 @@ FRotator FDynamicRotator::GetValue(ULuxAction* InAction) const
 	/** =============== 'FromLevelData'인 경우 =============== */
 	if (Source == EPhaseParameterSource::FromLevelData)
 	{
-		// ASC 를 통해 FActiveLuxAction 검색합니다.
-		const FActiveLuxAction* ActiveAction = InAction->GetActionSystemComponent()->FindActiveAction(InAction->GetActiveHandle());
-		if (!InAction->LevelDataTable || !ActiveAction || DataKey.IsNone())
+		if (!InAction->LevelDataTable || DataKey.IsNone())
 		{
 			return StaticValue;
 		}
 
+		const int32 ActionLevel = InAction->GetActionLevel();
+
 		// LevelDataTable 에서 액션 레벨에 해당하는 FLuxActionLevelData 을 검색합니다.
-		const FName RowName = FName(*FString::FromInt(ActiveAction->Spec.Level));
+		const FName RowName = FName(*FString::FromInt(ActionLevel));
 		const FLuxActionLevelData* LevelData = InAction->LevelDataTable->FindRow<FLuxActionLevelData>(RowName, TEXT(""));
 		if (!LevelData)
 		{
@@ -150,15 +150,15 @@ float FDynamicFloat::GetValue(ULuxAction* InAction) const
 	/** =============== 'FromLevelData'인 경우 =============== */
 	if (Source == EPhaseParameterSource::FromLevelData)
 	{
-		// ASC 를 통해 FActiveLuxAction 검색합니다.
-		const FActiveLuxAction* ActiveAction = InAction->GetActionSystemComponent()->FindActiveAction(InAction->GetActiveHandle());
-		if (!InAction->LevelDataTable || !ActiveAction || DataKey.IsNone())
+		if (!InAction->LevelDataTable || DataKey.IsNone())
 		{
 			return StaticValue;
 		}
 
+		const int32 ActionLevel = InAction->GetActionLevel();
+
 		// LevelDataTable 에서 액션 레벨에 해당하는 FLuxActionLevelData 을 검색합니다.
-		const FName RowName = FName(*FString::FromInt(ActiveAction->Spec.Level));
+		const FName RowName = FName(*FString::FromInt(ActionLevel));
 		const FLuxActionLevelData* LevelData = InAction->LevelDataTable->FindRow<FLuxActionLevelData>(RowName, TEXT(""));
 		if (!LevelData)
 		{
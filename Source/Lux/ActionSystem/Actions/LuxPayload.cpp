@@ -5,6 +5,377 @@
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
 #include "UObject/UObjectGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "LuxLogChannels.h"
+
+// ==================== 양자화 헬퍼 ====================
+
+namespace LuxPayloadQuantization
+{
+    void SerializePrecision(FArchive& Ar, uint8& Precision)
+    {
+        // 두 정밀도 열거형 모두 8 가지 이하이므로 3비트면 충분합니다.
+        Ar.SerializeBits(&Precision, 3);
+        if (Ar.IsLoading())
+        {
+            Precision &= 0x7;
+        }
+    }
+
+    bool SerializeVectorValue(FArchive& Ar, FVector& Value, ELuxVectorPrecision Precision)
+    {
+        switch (Precision)
+        {
+        case ELuxVectorPrecision::Quantize:     return SerializePackedVector<1, 24>(Value, Ar);
+        case ELuxVectorPrecision::Quantize10:   return SerializePackedVector<10, 24>(Value, Ar);
+        case ELuxVectorPrecision::Quantize100:  return SerializePackedVector<100, 30>(Value, Ar);
+        case ELuxVectorPrecision::Normal:       return SerializeFixedVector<1, 16>(Value, Ar);
+        default:
+            Ar << Value;
+            return true;
+        }
+    }
+
+    bool SerializeVector(FArchive& Ar, FVector& Value, ELuxVectorPrecision& Precision)
+    {
+        uint8 PrecisionValue = static_cast<uint8>(Precision);
+        SerializePrecision(Ar, PrecisionValue);
+        Precision = static_cast<ELuxVectorPrecision>(PrecisionValue);
+
+        return SerializeVectorValue(Ar, Value, Precision);
+    }
+
+    void SerializeRotator(FArchive& Ar, FRotator& Value, ELuxRotatorPrecision& Precision)
+    {
+        uint8 PrecisionValue = static_cast<uint8>(Precision);
+        SerializePrecision(Ar, PrecisionValue);
+        Precision = static_cast<ELuxRotatorPrecision>(PrecisionValue);
+
+        switch (Precision)
+        {
+        case ELuxRotatorPrecision::Short:   Value.SerializeCompressedShort(Ar); break;
+        case ELuxRotatorPrecision::Byte:    Value.SerializeCompressed(Ar); break;
+        default:                            Ar << Value; break;
+        }
+    }
+
+    /** 임의의 경로 점/회전 표본을 정밀도별로 직렬화하여 바이트 수와 왕복 오차를 출력합니다. */
+    static void ReportCommand(const TArray<FString>& Args)
+    {
+        const int32 NumSamples = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, static_cast<int32>(MaxNetPathPoints)) : 64;
+
+        // 지형을 따라가는 경로와 비슷하도록 월드 임의 위치에서 시작해 점 사이 간격을 50~150 cm 로 둡니다.
+        FRandomStream Random(NumSamples);
+        TArray<FVector> PathPoints;
+        TArray<FRotator> Rotators;
+        FVector Current(Random.FRandRange(-20000.0, 20000.0), Random.FRandRange(-20000.0, 20000.0), Random.FRandRange(0.0, 2000.0));
+        for (int32 i = 0; i < NumSamples; ++i)
+        {
+            Current += FVector(Random.FRandRange(50.0, 150.0), Random.FRandRange(-30.0, 30.0), Random.FRandRange(-10.0, 10.0));
+            PathPoints.Add(Current);
+            Rotators.Add(FRotator(Random.FRandRange(-90.0, 90.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0)));
+        }
+
+        UE_LOG(LogLux, Log, TEXT("Lux.Payload.QuantizationReport: 표본 %d 개"), NumSamples);
+
+        const ELuxVectorPrecision VectorPrecisions[] = { ELuxVectorPrecision::Full, ELuxVectorPrecision::Quantize, ELuxVectorPrecision::Quantize10, ELuxVectorPrecision::Quantize100 };
+        for (const ELuxVectorPrecision Precision : VectorPrecisions)
+        {
+            FPayload_PathData Original;
+            Original.PathPoints = PathPoints;
+            Original.Precision = Precision;
+
+            bool bSuccess = true;
+            FBitWriter Writer(0, true);
+            Original.NetSerialize(Writer, nullptr, bSuccess);
+
+            FPayload_PathData Decoded;
+            FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+            Decoded.NetSerialize(Reader, nullptr, bSuccess);
+
+            double MaxError = 0.0;
+            for (int32 i = 0; i < PathPoints.Num() && i < Decoded.PathPoints.Num(); ++i)
+            {
+                MaxError = FMath::Max(MaxError, FVector::Dist(PathPoints[i], Decoded.PathPoints[i]));
+            }
+
+            UE_LOG(LogLux, Log, TEXT("  PathData %-40s : %6lld bytes (%.2f bytes/점), 최대 오차 %.4f cm, 왕복 %s"),
+                *UEnum::GetValueAsString(Precision), Writer.GetNumBytes(), static_cast<double>(Writer.GetNumBytes()) / NumSamples, MaxError,
+                bSuccess && Decoded.PathPoints.Num() == PathPoints.Num() ? TEXT("성공") : TEXT("실패"));
+        }
+
+        const ELuxRotatorPrecision RotatorPrecisions[] = { ELuxRotatorPrecision::Full, ELuxRotatorPrecision::Short, ELuxRotatorPrecision::Byte };
+        for (const ELuxRotatorPrecision Precision : RotatorPrecisions)
+        {
+            FBitWriter Writer(0, true);
+            for (const FRotator& Rotator : Rotators)
+            {
+                FPayload_Rotator Original;
+                Original.Value = Rotator;
+                Original.Precision = Precision;
+
+                bool bSuccess = true;
+                Original.NetSerialize(Writer, nullptr, bSuccess);
+            }
+
+            FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+            double MaxError = 0.0;
+            for (const FRotator& Rotator : Rotators)
+            {
+                FPayload_Rotator Decoded;
+                bool bSuccess = true;
+                Decoded.NetSerialize(Reader, nullptr, bSuccess);
+                MaxError = FMath::Max(MaxError, (Decoded.Value - Rotator).GetNormalized().Euler().GetAbsMax());
+            }
+
+            UE_LOG(LogLux, Log, TEXT("  Rotator  %-40s : %6lld bytes (%.2f bytes/개), 최대 오차 %.4f 도"),
+                *UEnum::GetValueAsString(Precision), Writer.GetNumBytes(), static_cast<double>(Writer.GetNumBytes()) / NumSamples, MaxError);
+        }
+    }
+
+    static FAutoConsoleCommandWithArgs ReportConsoleCommand(
+        TEXT("Lux.Payload.QuantizationReport"),
+        TEXT("벡터/회전/경로 페이로드를 정밀도별로 직렬화하여 바이트 수와 왕복 오차를 출력합니다. 사용법: Lux.Payload.QuantizationReport [표본 수]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&ReportCommand));
+}
+
+// ==================== 경로 코덱 ====================
+
+namespace LuxPathCodec
+{
+    /** 정수 좌표의 절댓값 한계. 연속한 두 점의 차이가 int32 안에 들어오도록 2^30 으로 제한합니다. */
+    static constexpr int64 MaxQuantizedCoordinate = (1 << 30) - 1;
+
+    static double GetQuantizationScale(ELuxVectorPrecision Precision)
+    {
+        switch (Precision)
+        {
+        case ELuxVectorPrecision::Quantize:     return 1.0;
+        case ELuxVectorPrecision::Quantize10:   return 10.0;
+        case ELuxVectorPrecision::Quantize100:  return 100.0;
+        default:                                return 0.0;
+        }
+    }
+
+    static uint32 ZigZagEncode(int32 Value)
+    {
+        return (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+    }
+
+    static int32 ZigZagDecode(uint32 Value)
+    {
+        return static_cast<int32>(Value >> 1) ^ -static_cast<int32>(Value & 1);
+    }
+
+    void SimplifyPath(const TArray<FVector>& InPoints, double MaxDeviation, TArray<FVector>& OutPoints)
+    {
+        OutPoints.Reset();
+
+        if (InPoints.Num() <= 2 || MaxDeviation <= 0.0)
+        {
+            OutPoints = InPoints;
+            return;
+        }
+
+        TBitArray<> KeepPoint(false, InPoints.Num());
+        KeepPoint[0] = true;
+        KeepPoint[InPoints.Num() - 1] = true;
+
+        // 재귀 대신 구간 스택을 사용하여 긴 경로에서도 스택 깊이가 늘어나지 않도록 합니다.
+        TArray<TPair<int32, int32>, TInlineAllocator<32>> Spans;
+        Spans.Emplace(0, InPoints.Num() - 1);
+
+        while (Spans.Num() > 0)
+        {
+            const TPair<int32, int32> Span = Spans.Pop(EAllowShrinking::No);
+
+            int32 FarthestIndex = INDEX_NONE;
+            double FarthestDistance = MaxDeviation;
+            for (int32 i = Span.Key + 1; i < Span.Value; ++i)
+            {
+                const double Distance = FMath::PointDistToSegment(InPoints[i], InPoints[Span.Key], InPoints[Span.Value]);
+                if (Distance > FarthestDistance)
+                {
+                    FarthestDistance = Distance;
+                    FarthestIndex = i;
+                }
+            }
+
+            // 허용 오차를 넘는 점이 있으면 그 점을 남기고 양쪽 구간을 다시 검사합니다.
+            if (FarthestIndex != INDEX_NONE)
+            {
+                KeepPoint[FarthestIndex] = true;
+                Spans.Emplace(Span.Key, FarthestIndex);
+                Spans.Emplace(FarthestIndex, Span.Value);
+            }
+        }
+
+        for (TConstSetBitIterator<> It(KeepPoint); It; ++It)
+        {
+            OutPoints.Add(InPoints[It.GetIndex()]);
+        }
+    }
+
+    double GetQuantizationError(ELuxVectorPrecision Precision)
+    {
+        const double Scale = GetQuantizationScale(Precision);
+
+        // 축마다 최대 반 칸씩 어긋나므로 대각선 길이가 최대 오차입니다.
+        return Scale > 0.0 ? UE_SQRT_3 * 0.5 / Scale : 0.0;
+    }
+
+    bool SerializePath(FArchive& Ar, TArray<FVector>& Points, ELuxVectorPrecision Precision)
+    {
+        uint32 NumPoints = static_cast<uint32>(Points.Num());
+        Ar.SerializeIntPacked(NumPoints);
+
+        if (Ar.IsLoading())
+        {
+            if (NumPoints > LuxPayloadQuantization::MaxNetPathPoints)
+            {
+                Ar.SetError();
+                return false;
+            }
+            Points.SetNumUninitialized(NumPoints);
+        }
+
+        const double Scale = GetQuantizationScale(Precision);
+        if (Scale <= 0.0)
+        {
+            for (FVector& Point : Points)
+            {
+                Ar << Point;
+            }
+            return !Ar.IsError();
+        }
+
+        bool bValid = true;
+        int64 Previous[3] = { 0, 0, 0 };
+
+        for (FVector& Point : Points)
+        {
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                int64 Quantized = 0;
+                uint32 Encoded = 0;
+
+                if (Ar.IsSaving())
+                {
+                    Quantized = FMath::RoundToInt64(Point[Axis] * Scale);
+                    if (FMath::Abs(Quantized) > MaxQuantizedCoordinate)
+                    {
+                        Quantized = FMath::Clamp<int64>(Quantized, -MaxQuantizedCoordinate, MaxQuantizedCoordinate);
+                        bValid = false;
+                    }
+                    Encoded = ZigZagEncode(static_cast<int32>(Quantized - Previous[Axis]));
+                }
+
+                Ar.SerializeIntPacked(Encoded);
+
+                if (Ar.IsLoading())
+                {
+                    Quantized = Previous[Axis] + ZigZagDecode(Encoded);
+                    if (FMath::Abs(Quantized) > MaxQuantizedCoordinate)
+                    {
+                        Ar.SetError();
+                        return false;
+                    }
+                    Point[Axis] = static_cast<double>(Quantized) / Scale;
+                }
+
+                Previous[Axis] = Quantized;
+            }
+        }
+
+        return bValid && !Ar.IsError();
+    }
+
+    double MeasureMaxDeviation(const TArray<FVector>& Original, const TArray<FVector>& Decoded)
+    {
+        double MaxDeviation = 0.0;
+        for (const FVector& Point : Original)
+        {
+            double Nearest = Decoded.Num() == 1 ? FVector::Dist(Point, Decoded[0]) : TNumericLimits<double>::Max();
+            for (int32 i = 0; i + 1 < Decoded.Num(); ++i)
+            {
+                Nearest = FMath::Min<double>(Nearest, FMath::PointDistToSegment(Point, Decoded[i], Decoded[i + 1]));
+            }
+            MaxDeviation = FMath::Max(MaxDeviation, Nearest);
+        }
+        return MaxDeviation;
+    }
+
+    TArray<FVector> MakeHillPath(int32 Seed, int32 NumPoints, double StepSize)
+    {
+        // 전방으로 StepSize 마다 점을 찍고, 높이는 완만한 언덕을 따라가도록 합니다.
+        FRandomStream Random(Seed);
+        const FVector Start(Random.FRandRange(-20000.0, 20000.0), Random.FRandRange(-20000.0, 20000.0), Random.FRandRange(0.0, 2000.0));
+        const FVector Forward = FVector(Random.FRandRange(-1.0, 1.0), Random.FRandRange(-1.0, 1.0), 0.0).GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+        const double HillLength = Random.FRandRange(800.0, 2000.0);
+        const double HillHeight = Random.FRandRange(50.0, 300.0);
+
+        TArray<FVector> Points;
+        Points.Reserve(NumPoints);
+        for (int32 i = 0; i < NumPoints; ++i)
+        {
+            const double Distance = StepSize * i;
+            Points.Add(Start + Forward * Distance + FVector(0.0, 0.0, HillHeight * FMath::Sin(Distance / HillLength * UE_TWO_PI)));
+        }
+        return Points;
+    }
+
+    /** TraceAndBuildPath 와 비슷한 촘촘한 경로를 만들어 기존 점 단위 전송과 코덱의 크기 및 오차 한계를 비교합니다. */
+    static void ReportCommand(const TArray<FString>& Args)
+    {
+        const int32 NumPoints = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 2, static_cast<int32>(LuxPayloadQuantization::MaxNetPathPoints)) : 240;
+        const double Tolerance = Args.Num() > 1 ? FMath::Max(0.0, FCString::Atod(*Args[1])) : 2.0;
+        constexpr double StepSize = 50.0;
+        const TArray<FVector> PathPoints = MakeHillPath(NumPoints, NumPoints, StepSize);
+
+        UE_LOG(LogLux, Log, TEXT("Lux.Payload.PathCodecReport: 점 %d 개, 간격 %.0f cm, 허용 오차 %.2f cm"), NumPoints, StepSize, Tolerance);
+
+        const ELuxVectorPrecision Precisions[] = { ELuxVectorPrecision::Quantize, ELuxVectorPrecision::Quantize10, ELuxVectorPrecision::Quantize100 };
+        for (const ELuxVectorPrecision Precision : Precisions)
+        {
+            // 기존 형식: 점 개수 + 점마다 SerializePackedVector
+            FBitWriter LegacyWriter(0, true);
+            uint32 LegacyCount = static_cast<uint32>(PathPoints.Num());
+            LegacyWriter.SerializeIntPacked(LegacyCount);
+            for (FVector Point : PathPoints)
+            {
+                LuxPayloadQuantization::SerializeVectorValue(LegacyWriter, Point, Precision);
+            }
+
+            FPayload_PathData Original;
+            Original.PathPoints = PathPoints;
+            Original.Precision = Precision;
+            Original.Simplify(Tolerance);
+
+            bool bSuccess = true;
+            FBitWriter Writer(0, true);
+            Original.NetSerialize(Writer, nullptr, bSuccess);
+
+            FPayload_PathData Decoded;
+            FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+            Decoded.NetSerialize(Reader, nullptr, bSuccess);
+
+            const double MaxDeviation = MeasureMaxDeviation(PathPoints, Decoded.PathPoints);
+            const double Bound = Tolerance + GetQuantizationError(Precision);
+
+            UE_LOG(LogLux, Log, TEXT("  %-40s : 기존 %6lld bytes -> %6lld bytes (%.1fx, 점 %d 개), 최대 편차 %.4f cm / 한계 %.4f cm, %s"),
+                *UEnum::GetValueAsString(Precision), LegacyWriter.GetNumBytes(), Writer.GetNumBytes(),
+                static_cast<double>(LegacyWriter.GetNumBytes()) / FMath::Max<int64>(1, Writer.GetNumBytes()), Decoded.PathPoints.Num(),
+                MaxDeviation, Bound, bSuccess && MaxDeviation <= Bound + UE_KINDA_SMALL_NUMBER ? TEXT("통과") : TEXT("실패"));
+        }
+    }
+
+    static FAutoConsoleCommandWithArgs ReportConsoleCommand(
+        TEXT("Lux.Payload.PathCodecReport"),
+        TEXT("촘촘한 경로를 단순화 + 델타 부호화하여 기존 형식 대비 크기와 최대 편차가 한계 이내인지 출력합니다. 사용법: Lux.Payload.PathCodecReport [점 수] [허용 오차 cm]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&ReportCommand));
+}
 
 // ==================== 기본 페이로드 NetSerialize 구현 ====================
 
@@ -77,7 +448,9 @@ bool FPayload_Float::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bO
 bool FPayload_Vector::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
     bOutSuccess = true;
-    Ar << Value;
+
+    // 양자화 범위를 벗어나 잘린 값도 전송은 되므로 실패로 처리하지 않습니다.
+    LuxPayloadQuantization::SerializeVector(Ar, Value, Precision);
     return bOutSuccess;
 }
 
@@ -87,7 +460,7 @@ bool FPayload_Vector::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& b
 bool FPayload_Rotator::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
     bOutSuccess = true;
-    Ar << Value;
+    LuxPayloadQuantization::SerializeRotator(Ar, Value, Precision);
     return bOutSuccess;
 }
 
@@ -99,10 +472,30 @@ bool FPayload_Rotator::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool&
 bool FPayload_PathData::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
     bOutSuccess = true;
-    Ar << PathPoints;
+
+    // 정밀도는 경로 전체에 한 번만 보냅니다.
+    uint8 PrecisionValue = static_cast<uint8>(Precision);
+    LuxPayloadQuantization::SerializePrecision(Ar, PrecisionValue);
+    Precision = static_cast<ELuxVectorPrecision>(PrecisionValue);
+
+    // 송신 측에서 좌표가 잘린 경우는 기존처럼 전송을 계속하고, 수신 측의 잘못된 데이터만 실패로 처리합니다.
+    if (!LuxPathCodec::SerializePath(Ar, PathPoints, Precision) && Ar.IsLoading())
+    {
+        PathPoints.Reset();
+        bOutSuccess = false;
+        return false;
+    }
+
     return bOutSuccess;
 }
 
+void FPayload_PathData::Simplify(double MaxDeviation)
+{
+    TArray<FVector> SimplifiedPoints;
+    LuxPathCodec::SimplifyPath(PathPoints, MaxDeviation, SimplifiedPoints);
+    PathPoints = MoveTemp(SimplifiedPoints);
+}
+
 /**
  * @brief FPayload_Damage의 NetSerialize 구현
  */
@@ -345,37 +738,389 @@ bool FPayload_StatusEffectEvent::NetSerialize(FArchive& Ar, class UPackageMap* M
     return bOutSuccess;
 }
 
-// ==================== 컨텍스트 페이로드 NetSerialize 구현 ====================
+// ==================== 컨텍스트 페이로드 항목 ====================
 
-bool FContextPayload::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+namespace LuxPayloadAllocation
 {
-    bOutSuccess = true;
+#if !UE_BUILD_SHIPPING
+    static int64 InlineEntries = 0;
+    static int64 HeapEntries = 0;
+#endif
 
-    // 키 배열 직렬화/역직렬화
-    Ar << DataKeys;
-    if (!bOutSuccess)
+    static void AllocationStatsCommand(const TArray<FString>& Args)
+    {
+        const FContextPayloadAllocationStats Stats = FContextPayload::GetAllocationStats();
+        const int64 Total = Stats.InlineEntries + Stats.HeapEntries;
+
+        UE_LOG(LogLux, Log, TEXT("Lux.Payload.AllocationStats: 항목 %lld 개 중 인라인 %lld 개, 힙 할당 %lld 개 (힙 할당 회피율 %.1f%%)"),
+            Total, Stats.InlineEntries, Stats.HeapEntries, Total > 0 ? 100.0 * Stats.InlineEntries / Total : 0.0);
+    }
+
+    static FAutoConsoleCommandWithArgs AllocationStatsConsoleCommand(
+        TEXT("Lux.Payload.AllocationStats"),
+        TEXT("컨텍스트 페이로드 항목이 인라인 버퍼와 힙 중 어디에 저장되었는지 누적 횟수를 출력합니다. (Shipping 빌드 제외)"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&AllocationStatsCommand));
+}
+
+FContextPayloadEntry::FContextPayloadEntry(const FContextPayloadEntry& Other)
+    : KeyId(Other.KeyId)
+    , KeyName(Other.KeyName)
+{
+    InitializeAs(Other.ScriptStruct, Other.ScriptStruct ? Other.GetMemory() : nullptr);
+}
+
+FContextPayloadEntry& FContextPayloadEntry::operator=(const FContextPayloadEntry& Other)
+{
+    if (this != &Other)
+    {
+        KeyId = Other.KeyId;
+        KeyName = Other.KeyName;
+        InitializeAs(Other.ScriptStruct, Other.ScriptStruct ? Other.GetMemory() : nullptr);
+    }
+    return *this;
+}
+
+FContextPayloadEntry::~FContextPayloadEntry()
+{
+    Reset();
+}
+
+void FContextPayloadEntry::InitializeAs(const UScriptStruct* InScriptStruct, const void* StructMemory)
+{
+    // 같은 타입이면 메모리를 재사용하고 값만 복사합니다.
+    if (InScriptStruct && InScriptStruct == ScriptStruct)
     {
+        if (StructMemory)
+        {
+            ScriptStruct->CopyScriptStruct(GetMutableMemory(), StructMemory);
+        }
+        return;
+    }
+
+    Reset();
+
+    if (!InScriptStruct)
+    {
+        return;
+    }
+
+    const int32 StructSize = InScriptStruct->GetStructureSize();
+    const int32 StructAlignment = InScriptStruct->GetMinAlignment();
+    const bool bFitsInline = StructSize <= InlineSize && StructAlignment <= InlineAlignment;
+
+    if (!bFitsInline)
+    {
+        HeapMemory = static_cast<uint8*>(FMemory::Malloc(FMath::Max(1, StructSize), StructAlignment));
+    }
+
+#if !UE_BUILD_SHIPPING
+    FPlatformAtomics::InterlockedIncrement(bFitsInline ? &LuxPayloadAllocation::InlineEntries : &LuxPayloadAllocation::HeapEntries);
+#endif
+
+    ScriptStruct = InScriptStruct;
+    ScriptStruct->InitializeStruct(GetMutableMemory());
+
+    if (StructMemory)
+    {
+        ScriptStruct->CopyScriptStruct(GetMutableMemory(), StructMemory);
+    }
+}
+
+void FContextPayloadEntry::Reset()
+{
+    if (ScriptStruct)
+    {
+        ScriptStruct->DestroyStruct(GetMutableMemory());
+        ScriptStruct = nullptr;
+    }
+
+    if (HeapMemory)
+    {
+        FMemory::Free(HeapMemory);
+        HeapMemory = nullptr;
+    }
+}
+
+bool FContextPayloadEntry::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+    uint8 bHasStruct = Ar.IsSaving() && ScriptStruct ? 1 : 0;
+    Ar.SerializeBits(&bHasStruct, 1);
+
+    if (!bHasStruct)
+    {
+        if (Ar.IsLoading())
+        {
+            Reset();
+        }
+        return true;
+    }
+
+    UScriptStruct* SerializedStruct = const_cast<UScriptStruct*>(ScriptStruct);
+    Ar << SerializedStruct;
+
+    if (Ar.IsLoading())
+    {
+        InitializeAs(SerializedStruct, nullptr);
+    }
+
+    if (!ScriptStruct || !EnumHasAnyFlags(ScriptStruct->StructFlags, STRUCT_NetSerializeNative))
+    {
+        UE_LOG(LogLux, Warning, TEXT("FContextPayloadEntry::NetSerialize: '%s' 구조체는 NetSerialize 를 구현하지 않았습니다."), *GetNameSafe(ScriptStruct));
+        bOutSuccess = false;
         return false;
     }
 
-    // 데이터 배열 크기 직렬화/역직렬화
-    int32 ArraySize = DataArray.Num();
-    Ar << ArraySize;
+    ScriptStruct->GetCppStructOps()->NetSerialize(Ar, Map, bOutSuccess, GetMutableMemory());
+    return bOutSuccess;
+}
+
+void FContextPayloadEntry::AddStructReferencedObjects(FReferenceCollector& Collector)
+{
+    if (ScriptStruct)
+    {
+        Collector.AddReferencedObject(ScriptStruct);
+        Collector.AddPropertyReferences(ScriptStruct, GetMutableMemory());
+    }
+}
+
+void FContextPayload::AddStructReferencedObjects(FReferenceCollector& Collector)
+{
+    for (FContextPayloadEntry& Entry : Entries)
+    {
+        Entry.AddStructReferencedObjects(Collector);
+    }
+}
+
+// ==================== 컨텍스트 페이로드 NetSerialize 구현 ====================
+
+bool FContextPayload::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = true;
+
+    // 하나의 페이로드가 가질 수 있는 최대 항목 수 (잘못된 패킷으로 인한 과도한 할당 방지)
+    static constexpr uint32 MaxNetEntries = 64;
+
+    uint32 NumEntries = static_cast<uint32>(Entries.Num());
+    Ar.SerializeIntPacked(NumEntries);
 
     if (Ar.IsLoading())
     {
-        DataArray.Empty();
-        DataArray.SetNum(ArraySize);
+        if (NumEntries > MaxNetEntries)
+        {
+            bOutSuccess = false;
+            return false;
+        }
+
+        Entries.Reset();
+        Entries.SetNum(NumEntries);
     }
 
-    // 각 FInstancedStruct의 내장 NetSerialize 사용
-    for (int32 i = 0; i < ArraySize; ++i)
+    FLuxPayloadKeyRegistry& Registry = FLuxPayloadKeyRegistry::Get();
+
+    for (FContextPayloadEntry& Entry : Entries)
     {
-        if (!DataArray[i].NetSerialize(Ar, Map, bOutSuccess))
+        // 정적 키는 (ID << 1) 만, 동적 키는 1 과 키 이름을 보냅니다.
+        uint32 PackedKey = 0;
+        if (Ar.IsSaving())
+        {
+            PackedKey = Registry.IsStaticKey(Entry.KeyId) ? (static_cast<uint32>(Entry.KeyId) << 1) : 1;
+        }
+        Ar.SerializeIntPacked(PackedKey);
+
+        if (PackedKey & 1)
+        {
+            FName KeyName = Ar.IsSaving() ? (Entry.KeyId != FLuxPayloadKeyRegistry::InvalidId ? Registry.GetKeyName(Entry.KeyId) : Entry.KeyName) : NAME_None;
+            Ar << KeyName;
+
+            if (Ar.IsLoading())
+            {
+                if (KeyName.IsNone())
+                {
+                    bOutSuccess = false;
+                    return false;
+                }
+
+                // 상대가 보낸 이름으로 전역 레지스트리를 늘리지 않도록 조회만 하고, 없는 키는 항목에 이름으로 보관합니다.
+                Entry.KeyId = Registry.FindKey(KeyName);
+                Entry.KeyName = Entry.KeyId == FLuxPayloadKeyRegistry::InvalidId ? KeyName : NAME_None;
+            }
+        }
+        else if (Ar.IsLoading())
+        {
+            const uint32 KeyValue = PackedKey >> 1;
+            if (KeyValue >= FLuxPayloadKeyRegistry::InvalidId || !Registry.IsStaticKey(static_cast<FLuxPayloadKeyId>(KeyValue)))
+            {
+                bOutSuccess = false;
+                return false;
+            }
+            Entry.KeyId = static_cast<FLuxPayloadKeyId>(KeyValue);
+            Entry.KeyName = NAME_None;
+        }
+
+        if (!Entry.NetSerialize(Ar, Map, bOutSuccess))
         {
             return false;
         }
     }
 
     return bOutSuccess;
-}
\ No newline at end of file
+}
+
+bool FContextPayload::CopyDataFrom(const FContextPayload& Source, const FName SourceKey, const FName DestinationKey)
+{
+    const int32 SourceIndex = Source.FindIndexByName(SourceKey);
+    if (SourceIndex == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // 자기 자신에서 복사하는 경우 항목 추가로 배열이 재할당될 수 있으므로 원본 항목을 먼저 복사해 둡니다.
+    if (&Source == this)
+    {
+        const FContextPayload SourceCopy = Source;
+        return CopyDataFrom(SourceCopy, SourceKey, DestinationKey);
+    }
+
+    const FContextPayloadEntry& SourceEntry = Source.Entries[SourceIndex];
+    FContextPayloadEntry* DestinationEntry = FindOrAddEntry(DestinationKey);
+    if (!DestinationEntry)
+    {
+        return false;
+    }
+
+    DestinationEntry->InitializeAs(SourceEntry.GetScriptStruct(), SourceEntry.GetScriptStruct() ? SourceEntry.GetMemory() : nullptr);
+    return true;
+}
+
+int32 FContextPayload::FindIndexByName(FName Key) const
+{
+    if (Key.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    const FLuxPayloadKeyId KeyId = FLuxPayloadKeyRegistry::Get().FindKey(Key);
+    return Entries.IndexOfByPredicate([KeyId, Key](const FContextPayloadEntry& Entry)
+    {
+        return Entry.KeyId == FLuxPayloadKeyRegistry::InvalidId ? Entry.KeyName == Key : Entry.KeyId == KeyId;
+    });
+}
+
+FContextPayloadEntry* FContextPayload::FindOrAddEntry(FName Key)
+{
+    if (Key.IsNone())
+    {
+        return nullptr;
+    }
+
+    const int32 Index = FindIndexByName(Key);
+    if (Index != INDEX_NONE)
+    {
+        return &Entries[Index];
+    }
+
+    // 동적 키 한도를 넘으면 ID 없이 이름으로 저장합니다.
+    FContextPayloadEntry& Entry = Entries.AddDefaulted_GetRef();
+    Entry.KeyId = FLuxPayloadKeyRegistry::Get().FindOrAddKey(Key);
+    if (Entry.KeyId == FLuxPayloadKeyRegistry::InvalidId)
+    {
+        Entry.KeyName = Key;
+    }
+    return &Entry;
+}
+
+FContextPayloadAllocationStats FContextPayload::GetAllocationStats()
+{
+    FContextPayloadAllocationStats Stats;
+#if !UE_BUILD_SHIPPING
+    Stats.InlineEntries = FPlatformAtomics::AtomicRead(&LuxPayloadAllocation::InlineEntries);
+    Stats.HeapEntries = FPlatformAtomics::AtomicRead(&LuxPayloadAllocation::HeapEntries);
+#endif
+    return Stats;
+}
+
+// ==================== 페이로드 키 레지스트리 ====================
+
+FLuxPayloadKeyRegistry& FLuxPayloadKeyRegistry::Get()
+{
+    static FLuxPayloadKeyRegistry Registry;
+    return Registry;
+}
+
+FLuxPayloadKeyId FLuxPayloadKeyRegistry::RegisterStaticKey(FName Key)
+{
+    FRWScopeLock WriteLock(RegistryLock, FRWScopeLockType::SLT_Write);
+
+    if (const FLuxPayloadKeyId* ExistingId = KeyToId.Find(Key))
+    {
+        return *ExistingId;
+    }
+
+    // 정적 키는 정적 초기화 단계에서 선언 순서대로 등록되므로 모든 동적 키보다 앞선 ID 를 갖습니다.
+    const FLuxPayloadKeyId NewId = AddKey_Locked(Key);
+    NumStaticKeys = IdToKey.Num();
+    return NewId;
+}
+
+FLuxPayloadKeyId FLuxPayloadKeyRegistry::FindOrAddKey(FName Key)
+{
+    if (Key.IsNone())
+    {
+        return InvalidId;
+    }
+
+    {
+        FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+        if (const FLuxPayloadKeyId* ExistingId = KeyToId.Find(Key))
+        {
+            return *ExistingId;
+        }
+    }
+
+    FRWScopeLock WriteLock(RegistryLock, FRWScopeLockType::SLT_Write);
+
+    // 락을 바꾸는 사이 다른 스레드가 같은 키를 추가했을 수 있으므로 다시 확인합니다.
+    if (const FLuxPayloadKeyId* ExistingId = KeyToId.Find(Key))
+    {
+        return *ExistingId;
+    }
+
+    if (IdToKey.Num() - NumStaticKeys >= MaxDynamicKeys)
+    {
+        UE_LOG(LogLux, Warning, TEXT("FLuxPayloadKeyRegistry: 동적 키가 %d 개를 넘어 '%s' 키는 이름으로 저장됩니다."), MaxDynamicKeys, *Key.ToString());
+        return InvalidId;
+    }
+
+    return AddKey_Locked(Key);
+}
+
+FLuxPayloadKeyId FLuxPayloadKeyRegistry::FindKey(FName Key) const
+{
+    if (Key.IsNone())
+    {
+        return InvalidId;
+    }
+
+    FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+    const FLuxPayloadKeyId* ExistingId = KeyToId.Find(Key);
+    return ExistingId ? *ExistingId : InvalidId;
+}
+
+FName FLuxPayloadKeyRegistry::GetKeyName(FLuxPayloadKeyId KeyId) const
+{
+    FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+    return IdToKey.IsValidIndex(KeyId) ? IdToKey[KeyId] : NAME_None;
+}
+
+FLuxPayloadKeyId FLuxPayloadKeyRegistry::AddKey_Locked(FName Key)
+{
+    if (!ensureMsgf(IdToKey.Num() < InvalidId, TEXT("페이로드 키 ID 가 고갈되었습니다.")))
+    {
+        return InvalidId;
+    }
+
+    const FLuxPayloadKeyId NewId = static_cast<FLuxPayloadKeyId>(IdToKey.Num());
+    IdToKey.Add(Key);
+    KeyToId.Add(Key, NewId);
+    return NewId;
+}
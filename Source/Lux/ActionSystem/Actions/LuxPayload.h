@@ -6,34 +6,187 @@
 #include "Engine/NetSerialization.h"
 #include "LuxPayload.generated.h"
 
-/** 페이로드 키 상수 */
+/** FLuxPayloadKeyRegistry 가 발급하는 페이로드 키 ID 입니다. */
+using FLuxPayloadKeyId = uint16;
+
+/**
+ * @class FLuxPayloadKeyRegistry
+ * @brief 페이로드 키(FName)에 작은 정수 ID 를 발급하는 전역 레지스트리입니다.
+ * LuxPayloadKeys 의 정적 키는 선언 순서대로 먼저 등록되므로 서버와 클라이언트에서 같은 ID 를 가지며,
+ * 네트워크로는 이 ID 만 전송합니다. 런타임에 처음 사용된 동적 키는 이름과 함께 전송합니다.
+ */
+class LUX_API FLuxPayloadKeyRegistry
+{
+public:
+    static FLuxPayloadKeyRegistry& Get();
+
+    /** 유효하지 않은 키 ID */
+    static constexpr FLuxPayloadKeyId InvalidId = MAX_uint16;
+
+    /** 정적 키를 등록합니다. LuxPayloadKeys 의 FLuxPayloadKey 생성자에서만 호출됩니다. */
+    FLuxPayloadKeyId RegisterStaticKey(FName Key);
+
+    /** 동적으로 등록할 수 있는 최대 키 수. 넘으면 FindOrAddKey 가 InvalidId 를 반환하고 호출 측은 이름으로 저장합니다. */
+    static constexpr int32 MaxDynamicKeys = 4096;
+
+    /**
+     * 키의 ID 를 반환합니다. 처음 보는 키라면 동적 키로 등록합니다.
+     * 로컬 코드/애셋의 키에만 사용하고, 네트워크로 받은 이름은 등록하지 않도록 FindKey 를 사용합니다.
+     */
+    FLuxPayloadKeyId FindOrAddKey(FName Key);
+
+    /** 키의 ID 를 반환합니다. 등록되지 않은 키(NAME_None 포함)라면 InvalidId 를 반환합니다. */
+    FLuxPayloadKeyId FindKey(FName Key) const;
+
+    /** ID 에 해당하는 키 이름을 반환합니다. */
+    FName GetKeyName(FLuxPayloadKeyId KeyId) const;
+
+    /** 모든 빌드에서 같은 ID 를 갖는 정적 키인지 확인합니다. */
+    bool IsStaticKey(FLuxPayloadKeyId KeyId) const { return KeyId < NumStaticKeys; }
+
+private:
+    FLuxPayloadKeyId AddKey_Locked(FName Key);
+
+    TMap<FName, FLuxPayloadKeyId> KeyToId;
+    TArray<FName> IdToKey;
+
+    /** 정적 키 수. ID 가 [0, NumStaticKeys) 인 키는 정적 키입니다. */
+    FLuxPayloadKeyId NumStaticKeys = 0;
+
+    mutable FRWLock RegistryLock;
+};
+
+/**
+ * @struct FLuxPayloadKey
+ * @brief 생성 시 레지스트리 ID 를 미리 받아 두는 정적 페이로드 키입니다.
+ * FName 으로 암시적 변환되므로 기존 FName 키 API 에도 그대로 사용할 수 있습니다.
+ */
+struct LUX_API FLuxPayloadKey
+{
+public:
+    explicit FLuxPayloadKey(const TCHAR* InName)
+        : Name(InName)
+        , Id(FLuxPayloadKeyRegistry::Get().RegisterStaticKey(Name))
+    {
+    }
+
+    operator FName() const { return Name; }
+
+    FName GetName() const { return Name; }
+    FLuxPayloadKeyId GetId() const { return Id; }
+
+private:
+    FName Name;
+    FLuxPayloadKeyId Id;
+};
+
+/** 페이로드 키 상수 (선언 순서가 곧 정적 키 ID 이므로 새 키는 끝에 추가합니다.) */
 namespace LuxPayloadKeys
 {
     // === 특화된 이벤트 타입 키들 ===
-    inline const FName CrowdControlEvent(TEXT("CrowdControlEvent"));
-    inline const FName DamageEvent(TEXT("DamageEvent"));
-    inline const FName HealingEvent(TEXT("HealingEvent"));
-    inline const FName StatusEffectEvent(TEXT("StatusEffectEvent"));
+    inline const FLuxPayloadKey CrowdControlEvent(TEXT("CrowdControlEvent"));
+    inline const FLuxPayloadKey DamageEvent(TEXT("DamageEvent"));
+    inline const FLuxPayloadKey HealingEvent(TEXT("HealingEvent"));
+    inline const FLuxPayloadKey StatusEffectEvent(TEXT("StatusEffectEvent"));
     
     // === 범용 이벤트 키 (하위 호환성) ===
-    inline const FName GameplayEventData(TEXT("GameplayEventData"));
+    inline const FLuxPayloadKey GameplayEventData(TEXT("GameplayEventData"));
     
     // === 기타 페이로드 키들 ===
-    inline const FName ActionSpec(TEXT("ActionSpec"));
-    inline const FName ActionTags(TEXT("ActionTags"));
-    inline const FName Level(TEXT("Level"));
-    inline const FName HitData(TEXT("HitData"));
-    inline const FName PathData(TEXT("PathData"));
-    inline const FName NotifyName(TEXT("NotifyName"));
-    inline const FName TargetingData(TEXT("TargetingData"));
+    inline const FLuxPayloadKey ActionSpec(TEXT("ActionSpec"));
+    inline const FLuxPayloadKey ActionTags(TEXT("ActionTags"));
+    inline const FLuxPayloadKey Level(TEXT("Level"));
+    inline const FLuxPayloadKey HitData(TEXT("HitData"));
+    inline const FLuxPayloadKey PathData(TEXT("PathData"));
+    inline const FLuxPayloadKey NotifyName(TEXT("NotifyName"));
+    inline const FLuxPayloadKey TargetingData(TEXT("TargetingData"));
     
     // === 공간 정보 키들 ===
-    inline const FName Location(TEXT("Location"));
-    inline const FName Rotation(TEXT("Rotation"));
-    inline const FName Direction(TEXT("Direction"));
+    inline const FLuxPayloadKey Location(TEXT("Location"));
+    inline const FLuxPayloadKey Rotation(TEXT("Rotation"));
+    inline const FLuxPayloadKey Direction(TEXT("Direction"));
     
     // === 레거시 키들 (새 코드에서는 특화된 구조체 사용 권장) ===
-    inline const FName Damage(TEXT("Damage"));
+    inline const FLuxPayloadKey Damage(TEXT("Damage"));
+}
+
+// ==================== 양자화 정밀도 ====================
+
+/** 벡터 페이로드의 네트워크 양자화 정밀도입니다. (엔진의 FVector_NetQuantize 계열과 동일한 스케일) */
+UENUM(BlueprintType)
+enum class ELuxVectorPrecision : uint8
+{
+    /** 양자화하지 않고 전체 정밀도로 전송합니다. */
+    Full,
+
+    /** 1 cm 단위 (FVector_NetQuantize) */
+    Quantize,
+
+    /** 0.1 cm 단위 (FVector_NetQuantize10) */
+    Quantize10,
+
+    /** 0.01 cm 단위 (FVector_NetQuantize100) */
+    Quantize100,
+
+    /** 축당 16비트의 [-1, 1] 범위 단위 벡터 (FVector_NetQuantizeNormal). 방향 전용이며 경로에서는 Full 로 취급합니다. */
+    Normal
+};
+
+/** 회전 페이로드의 네트워크 양자화 정밀도입니다. */
+UENUM(BlueprintType)
+enum class ELuxRotatorPrecision : uint8
+{
+    /** 양자화하지 않고 전체 정밀도로 전송합니다. */
+    Full,
+
+    /** 축당 16비트 (약 0.0055도, FRotator::SerializeCompressedShort) */
+    Short,
+
+    /** 축당 8비트 (약 1.4도, FRotator::SerializeCompressed) */
+    Byte
+};
+
+/** 페이로드 직렬화에서 공통으로 사용하는 양자화 헬퍼입니다. */
+namespace LuxPayloadQuantization
+{
+    /** 경로 한 번에 전송할 수 있는 최대 점 수 (잘못된 패킷으로 인한 과도한 할당 방지) */
+    inline constexpr uint32 MaxNetPathPoints = 1024;
+
+    /** 정밀도 값(3비트)과 함께 벡터를 직렬화합니다. 범위를 벗어나 잘린 경우 false 를 반환합니다. */
+    LUX_API bool SerializeVector(FArchive& Ar, FVector& Value, ELuxVectorPrecision& Precision);
+
+    /** 정밀도를 별도로 직렬화한 뒤 벡터 값만 직렬화합니다. (경로처럼 같은 정밀도의 값이 반복될 때 사용) */
+    LUX_API bool SerializeVectorValue(FArchive& Ar, FVector& Value, ELuxVectorPrecision Precision);
+
+    /** 정밀도 값(3비트)과 함께 회전을 직렬화합니다. */
+    LUX_API void SerializeRotator(FArchive& Ar, FRotator& Value, ELuxRotatorPrecision& Precision);
+
+    /** 정밀도 값을 3비트로 직렬화합니다. */
+    LUX_API void SerializePrecision(FArchive& Ar, uint8& Precision);
+}
+
+/**
+ * 경로(폴리라인) 코덱
+ * 1. SimplifyPath: 허용 오차 이내에서 거의 직선인 구간의 점을 제거합니다. (Douglas-Peucker)
+ * 2. SerializePath: 점을 정밀도 격자의 정수 좌표로 바꾼 뒤, 첫 점 이후로는 직전 점과의 차이만 가변 길이 정수로 보냅니다.
+ * 복원은 정수 누적으로만 이루어지므로 어느 머신에서나 같은 결과를 얻습니다.
+ */
+namespace LuxPathCodec
+{
+    /** 원본 경로에서 MaxDeviation(cm) 이상 벗어나지 않도록 점을 줄입니다. 첫 점과 마지막 점은 항상 유지됩니다. */
+    LUX_API void SimplifyPath(const TArray<FVector>& InPoints, double MaxDeviation, TArray<FVector>& OutPoints);
+
+    /** 정밀도 격자로 반올림할 때 생기는 점 하나의 최대 오차(cm)를 반환합니다. Full 이면 0 입니다. */
+    LUX_API double GetQuantizationError(ELuxVectorPrecision Precision);
+
+    /** 점 개수와 점들을 델타 부호화하여 직렬화합니다. 잘못된 데이터를 받거나 좌표가 범위를 벗어나 잘리면 false 를 반환합니다. */
+    LUX_API bool SerializePath(FArchive& Ar, TArray<FVector>& Points, ELuxVectorPrecision Precision);
+
+    /** 원본 점들이 복원된 폴리라인에서 벗어난 최대 거리(cm)를 계산합니다. */
+    LUX_API double MeasureMaxDeviation(const TArray<FVector>& Original, const TArray<FVector>& Decoded);
+
+    /** TraceAndBuildPath 와 비슷하게 StepSize 간격으로 완만한 언덕을 따라가는 촘촘한 경로를 만듭니다. (코덱 리포트와 테스트용) */
+    LUX_API TArray<FVector> MakeHillPath(int32 Seed, int32 NumPoints, double StepSize = 50.0);
 }
 
 // ==================== 기본 페이로드 구조체들 ====================
@@ -117,6 +270,14 @@ struct FPayload_Vector : public FPayload
     UPROPERTY(BlueprintReadOnly)
     FVector Value = FVector::ZeroVector;
 
+    /**
+     * 네트워크 전송 시 사용할 양자화 정밀도
+     * 위치와 방향 중 어느 값이 담길지 알 수 없으므로 기본값은 Full 입니다. (Quantize10 은 단위 방향을 0.1 단위로 반올림합니다)
+     * 위치라면 Quantize 계열을, 단위 방향이라면 Normal 을 지정하여 크기를 줄입니다.
+     */
+    UPROPERTY(BlueprintReadOnly)
+    ELuxVectorPrecision Precision = ELuxVectorPrecision::Full;
+
     /** NetSerialize 구현 */
     virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override;
 };
@@ -130,6 +291,10 @@ struct FPayload_Rotator : public FPayload
     UPROPERTY(BlueprintReadOnly)
     FRotator Value = FRotator::ZeroRotator;
 
+    /** 네트워크 전송 시 사용할 양자화 정밀도 */
+    UPROPERTY(BlueprintReadOnly)
+    ELuxRotatorPrecision Precision = ELuxRotatorPrecision::Short;
+
     /** NetSerialize 구현 */
     virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override;
 };
@@ -145,6 +310,13 @@ struct FPayload_PathData : public FPayload
     UPROPERTY(BlueprintReadOnly)
     TArray<FVector> PathPoints;
 
+    /** 네트워크 전송 시 모든 점에 공통으로 사용할 양자화 정밀도 */
+    UPROPERTY(BlueprintReadOnly)
+    ELuxVectorPrecision Precision = ELuxVectorPrecision::Quantize10;
+
+    /** 허용 오차(cm) 이내에서 경로의 점을 줄입니다. 전송 전에 호출하면 송신 측과 수신 측이 같은 경로를 사용합니다. */
+    void Simplify(double MaxDeviation);
+
     /** NetSerialize 구현 */
     virtual bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess) override;
 };
@@ -386,11 +558,78 @@ struct FPayload_StatusEffectEvent : public FPayload_GameplayEventData
 
 // ==================== 컨텍스트 페이로드 ====================
 
+/**
+ * @struct FContextPayloadEntry
+ * @brief 컨텍스트 페이로드의 항목 하나입니다.
+ * 벡터, 회전, 태그, 실수처럼 작은 페이로드는 인라인 버퍼에 저장하고, 버퍼보다 큰 구조체만 힙에 할당합니다.
+ */
+struct LUX_API FContextPayloadEntry
+{
+public:
+    /** 인라인 버퍼 크기. FPayload_Vector / FPayload_Rotator / FPayload_TagContainer 가 들어가는 크기입니다. */
+    static constexpr int32 InlineSize = 48;
+    static constexpr int32 InlineAlignment = 16;
+
+    FContextPayloadEntry() = default;
+    FContextPayloadEntry(const FContextPayloadEntry& Other);
+    FContextPayloadEntry& operator=(const FContextPayloadEntry& Other);
+    ~FContextPayloadEntry();
+
+    /** 지정한 구조체 타입으로 초기화하고 StructMemory 의 값을 복사합니다. (StructMemory 가 nullptr 이면 기본값) */
+    void InitializeAs(const UScriptStruct* InScriptStruct, const void* StructMemory);
+
+    /** 저장된 구조체를 파괴하고 비웁니다. */
+    void Reset();
+
+    const UScriptStruct* GetScriptStruct() const { return ScriptStruct; }
+    const uint8* GetMemory() const { return HeapMemory ? HeapMemory : InlineBuffer; }
+
+    /** 저장된 구조체가 T 또는 T 의 파생 타입이면 포인터를 반환합니다. */
+    template <typename T>
+    const T* GetPtr() const
+    {
+        return ScriptStruct && ScriptStruct->IsChildOf(TBaseStructure<T>::Get()) ? reinterpret_cast<const T*>(GetMemory()) : nullptr;
+    }
+
+    /** 구조체 타입과 값을 직렬화합니다. (FInstancedStruct::NetSerialize 와 같은 방식) */
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+    /** 저장된 구조체 타입과 그 안의 객체 참조를 GC 에 보고합니다. */
+    void AddStructReferencedObjects(class FReferenceCollector& Collector);
+
+    /** 이 항목의 페이로드 키 ID */
+    FLuxPayloadKeyId KeyId = FLuxPayloadKeyRegistry::InvalidId;
+
+    /** 레지스트리에 없는 키의 이름 (KeyId 가 InvalidId 일 때만 사용) */
+    FName KeyName;
+
+private:
+    uint8* GetMutableMemory() { return HeapMemory ? HeapMemory : InlineBuffer; }
+
+    const UScriptStruct* ScriptStruct = nullptr;
+
+    /** 인라인 버퍼에 들어가지 않는 구조체만 사용하는 힙 메모리 */
+    uint8* HeapMemory = nullptr;
+
+    alignas(InlineAlignment) uint8 InlineBuffer[InlineSize];
+};
+
+/** 페이로드 항목 저장 위치별 누적 횟수입니다. (Shipping 빌드에서는 집계하지 않습니다.) */
+struct FContextPayloadAllocationStats
+{
+    /** 인라인 버퍼에 저장되어 힙 할당을 하지 않은 항목 수 */
+    int64 InlineEntries = 0;
+
+    /** 버퍼보다 커서 힙에 할당한 항목 수 */
+    int64 HeapEntries = 0;
+};
+
 /**
  * @struct FContextPayload
  * @brief 액션 시스템 전체에서 사용되는 통합 페이로드 구조체입니다.
  * @details 페이즈 간 데이터 전달, 태스크-액션 간 이벤트 데이터 전달 등
  * 모든 종류의 데이터 교환을 위한 표준 컨테이너 역할을 합니다.
+ * 대부분의 페이로드는 1~3 개의 작은 항목만 가지므로 항목 배열과 항목 값 모두 인라인으로 저장합니다.
  */
 USTRUCT(BlueprintType)
 struct FContextPayload
@@ -400,67 +639,116 @@ struct FContextPayload
     friend class ULuxAction;
 
 private:
-    // TMap 대신 배열 기반 구조 사용
-    UPROPERTY()
-    TArray<FInstancedStruct> DataArray;
+    /** 항목 배열. 항목 수가 인라인 용량을 넘을 때만 힙으로 옮겨집니다. */
+    TArray<FContextPayloadEntry, TInlineAllocator<3>> Entries;
 
-    // 키-값 쌍을 위한 별도 배열
-    UPROPERTY()
-    TArray<FName> DataKeys;
+    /** 키 ID 에 해당하는 Entries 인덱스를 반환합니다. 항목이 몇 개뿐이므로 정수 비교로 찾습니다. */
+    int32 FindIndex(FLuxPayloadKeyId KeyId) const
+    {
+        if (KeyId == FLuxPayloadKeyRegistry::InvalidId)
+        {
+            return INDEX_NONE;
+        }
+        return Entries.IndexOfByPredicate([KeyId](const FContextPayloadEntry& Entry) { return Entry.KeyId == KeyId; });
+    }
+
+    /** 키 이름에 해당하는 Entries 인덱스를 반환합니다. 레지스트리에 없는 키는 항목에 저장된 이름으로 찾습니다. */
+    int32 FindIndexByName(FName Key) const;
+
+    /** 키 이름에 해당하는 항목을 찾거나 추가합니다. NAME_None 이면 nullptr 을 반환합니다. */
+    FContextPayloadEntry* FindOrAddEntry(FName Key);
 
 public:
     /** 페이로드에 특정 구조체 데이터를 저장합니다. */
+    template <typename T>
+    void SetData(const FLuxPayloadKey& Key, const T& StructData)
+    {
+        SetDataById<T>(Key.GetId(), StructData);
+    }
+
     template <typename T>
     void SetData(const FName Key, const T& StructData)
     {
-        // 기존 키가 있으면 업데이트, 없으면 추가
-        int32 Index = DataKeys.Find(Key);
-        if (Index != INDEX_NONE)
+        if (FContextPayloadEntry* Entry = FindOrAddEntry(Key))
         {
-            DataArray[Index].InitializeAs<T>(StructData);
+            Entry->InitializeAs(TBaseStructure<T>::Get(), &StructData);
         }
-        else
+    }
+
+    template <typename T>
+    void SetDataById(FLuxPayloadKeyId KeyId, const T& StructData)
+    {
+        if (KeyId == FLuxPayloadKeyRegistry::InvalidId)
         {
-            DataKeys.Add(Key);
-            FInstancedStruct NewStruct;
-            NewStruct.InitializeAs<T>(StructData);
-            DataArray.Add(NewStruct);
+            return;
         }
+
+        // 기존 키가 있으면 업데이트, 없으면 추가
+        const int32 Index = FindIndex(KeyId);
+        FContextPayloadEntry& Entry = Index != INDEX_NONE ? Entries[Index] : Entries.AddDefaulted_GetRef();
+        Entry.KeyId = KeyId;
+        Entry.InitializeAs(TBaseStructure<T>::Get(), &StructData);
     }
 
     /** 페이로드에서 특정 구조체 데이터를 가져옵니다. (읽기 전용) */
+    template <typename T>
+    const T* GetData(const FLuxPayloadKey& Key) const
+    {
+        return GetDataById<T>(Key.GetId());
+    }
+
     template <typename T>
     const T* GetData(const FName Key) const
     {
-        int32 Index = DataKeys.Find(Key);
-        if (Index != INDEX_NONE && DataArray.IsValidIndex(Index))
-        {
-            return DataArray[Index].GetPtr<T>();
-        }
-        return nullptr;
+        // 조회만 하는 키는 레지스트리에 등록하지 않습니다.
+        const int32 Index = FindIndexByName(Key);
+        return Index != INDEX_NONE ? Entries[Index].GetPtr<T>() : nullptr;
+    }
+
+    template <typename T>
+    const T* GetDataById(FLuxPayloadKeyId KeyId) const
+    {
+        const int32 Index = FindIndex(KeyId);
+        return Index != INDEX_NONE ? Entries[Index].GetPtr<T>() : nullptr;
     }
 
     /** 특정 키의 데이터가 존재하는지 확인합니다. */
+    bool HasData(const FLuxPayloadKey& Key) const
+    {
+        return FindIndex(Key.GetId()) != INDEX_NONE;
+    }
+
     bool HasData(const FName Key) const
     {
-        return DataKeys.Contains(Key);
+        return FindIndexByName(Key) != INDEX_NONE;
     }
 
+    /** 다른 페이로드의 항목을 타입에 관계없이 복사합니다. 원본에 키가 없으면 false 를 반환합니다. */
+    bool CopyDataFrom(const FContextPayload& Source, const FName SourceKey, const FName DestinationKey);
+
     /** 모든 데이터를 제거합니다. */
     void Clear()
     {
-        DataArray.Empty();
-        DataKeys.Empty();
+        Entries.Empty();
     }
 
     /** 데이터 개수를 반환합니다. */
     int32 Num() const
     {
-        return DataArray.Num();
+        return Entries.Num();
     }
 
     /** 배열 데이터를 직렬화/역직렬화하는 함수입니다. */
     bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+    /**
+     * 항목들은 리플렉션되지 않는 버퍼에 저장되므로, 항목 구조체 안의 객체 참조(예: FLuxActionSpec::Action)를 직접 GC 에 보고합니다.
+     * FInstancedStruct 배열을 UPROPERTY 로 들고 있을 때와 같은 참조를 유지합니다.
+     */
+    void AddStructReferencedObjects(class FReferenceCollector& Collector);
+
+    /** 프로세스 시작 이후 항목 저장 위치별 누적 횟수를 반환합니다. ('Lux.Payload.AllocationStats' 로 출력) */
+    static FContextPayloadAllocationStats GetAllocationStats();
 };
 
 // ==================== TStructOpsTypeTraits 등록 ====================
@@ -601,10 +889,14 @@ struct TStructOpsTypeTraits<FPayload_StatusEffectEvent> : public TStructOpsTypeT
 };
 
 /**
- * FContextPayload의 NetSerializer 등록
+ * FContextPayload의 NetSerializer 및 GC 참조 보고 등록
  */
 template<>
 struct TStructOpsTypeTraits<FContextPayload> : public TStructOpsTypeTraitsBase2<FContextPayload>
 {
-    enum { WithNetSerializer = true };
+    enum
+    {
+        WithNetSerializer = true,
+        WithAddStructReferencedObjects = true,
+    };
 };
\ No newline at end of file
@@ -285,32 +285,19 @@ void FPhaseBehavior_StartCooldown::Execute(ULuxAction* Action) const
 		return;
 	}
 
-	FActiveLuxAction* ActiveAction = ASC->FindActiveAction(Action->GetActiveHandle());
-	if (!ActiveAction)
-	{
-		UE_LOG(LogLuxActionSystem, Error, TEXT("[StartCooldown] 활성 액션 정보를 찾을 수 없습니다."));
-		return;
-	}
-
-	const FLuxActionSpecHandle SpecHandle = ActiveAction->Spec.Handle;
+	// 실행 시 기록된 스펙 핸들과 스냅샷의 레벨을 사용하므로 활성 액션/스펙 목록을 탐색하지 않습니다.
+	const FLuxActionSpecHandle SpecHandle = Action->GetActiveSpecHandle();
 	if (!SpecHandle.IsValid())
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("[StartCooldown] 액션 스펙 핸들이 유효하지 않습니다."));
 		return;
 	}
 
-	const FLuxActionSpec* ActionSpec = ASC->FindActionSpecFromHandle(SpecHandle);
-	if (!ActionSpec)
-	{
-		UE_LOG(LogLuxActionSystem, Error, TEXT("[StartCooldown] 핸들로부터 액션 스펙을 찾을 수 없습니다."));
-		return;
-	}
-
 	// 쿨다운 이펙트 생성 및 적용
 	FLuxEffectContextHandle Context = ASC->MakeEffectContext();
 	Context.SetSourceAction(SpecHandle);
 
-	FLuxEffectSpecHandle CooldownSpecHandle = ASC->MakeOutgoingSpec(Action->Cooldown, ActionSpec->Level, Context);
+	FLuxEffectSpecHandle CooldownSpecHandle = ASC->MakeOutgoingSpec(Action->Cooldown, Action->GetActionLevel(), Context);
 	if (CooldownSpecHandle.IsValid())
 	{
 		FActiveLuxEffectHandle Tmp; ASC->ApplyEffectSpecToSelf(CooldownSpecHandle, Tmp);
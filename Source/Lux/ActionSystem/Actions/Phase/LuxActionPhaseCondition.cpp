@@ -7,7 +7,7 @@
 
 bool FCondition_PathHasMinPoints::CheckCondition(const ULuxAction& Action, const FContextPayload& Payload) const
 {
-    const FPayload_PathData* PathData = Payload.GetData<FPayload_PathData>(FName("PathData"));
+    const FPayload_PathData* PathData = Payload.GetData<FPayload_PathData>(LuxPayloadKeys::PathData);
     if (PathData)
     {
         return PathData->PathPoints.Num() >= MinPoints;
@@ -19,7 +19,7 @@ bool FCondition_PathHasMinPoints::CheckCondition(const ULuxAction& Action, const
 
 bool FCondition_NotifyNameEquals::CheckCondition(const ULuxAction& Action, const FContextPayload& Payload) const
 {
-    const FPayload_Name* PathData = Payload.GetData<FPayload_Name>(FName("NotifyName"));
+    const FPayload_Name* PathData = Payload.GetData<FPayload_Name>(LuxPayloadKeys::NotifyName);
     if (PathData)
     {
         return PathData->Value == RequiredName;
@@ -0,0 +1,227 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ActionSystem/Actions/LuxPayload.h"
+#include "Components/SplineComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace LuxPayloadTests
+{
+    static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+    /** 페이로드를 비트 스트림으로 보냈다가 다시 읽습니다. */
+    template<typename PayloadType>
+    static bool RoundTrip(PayloadType& Source, PayloadType& OutDecoded)
+    {
+        bool bWriteSuccess = true;
+        FBitWriter Writer(0, true);
+        Source.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+        bool bReadSuccess = true;
+        FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+        OutDecoded.NetSerialize(Reader, nullptr, bReadSuccess);
+
+        return bWriteSuccess && bReadSuccess && !Writer.IsError() && !Reader.IsError();
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLuxPathCodecDeviationTest, "Lux.Payload.PathCodec.DeviationBound", LuxPayloadTests::TestFlags)
+
+bool FLuxPathCodecDeviationTest::RunTest(const FString& Parameters)
+{
+    const ELuxVectorPrecision Precisions[] = { ELuxVectorPrecision::Full, ELuxVectorPrecision::Quantize, ELuxVectorPrecision::Quantize10, ELuxVectorPrecision::Quantize100 };
+    const double Tolerances[] = { 0.0, 0.5, 2.0, 10.0 };
+
+    for (int32 Seed = 1; Seed <= 8; ++Seed)
+    {
+        const TArray<FVector> PathPoints = LuxPathCodec::MakeHillPath(Seed, 240);
+
+        for (const ELuxVectorPrecision Precision : Precisions)
+        {
+            for (const double Tolerance : Tolerances)
+            {
+                FPayload_PathData Original;
+                Original.PathPoints = PathPoints;
+                Original.Precision = Precision;
+                Original.Simplify(Tolerance);
+
+                FPayload_PathData Decoded;
+                const bool bSuccess = LuxPayloadTests::RoundTrip(Original, Decoded);
+
+                // 단순화 오차와 격자 반올림 오차의 합을 넘지 않아야 합니다.
+                const double Bound = Tolerance + LuxPathCodec::GetQuantizationError(Precision);
+                const double MaxDeviation = LuxPathCodec::MeasureMaxDeviation(PathPoints, Decoded.PathPoints);
+                const FString Context = FString::Printf(TEXT("Seed %d, %s, Tolerance %.1f"), Seed, *UEnum::GetValueAsString(Precision), Tolerance);
+
+                TestTrue(FString::Printf(TEXT("%s: round trip succeeds"), *Context), bSuccess);
+                TestEqual(FString::Printf(TEXT("%s: point count"), *Context), Decoded.PathPoints.Num(), Original.PathPoints.Num());
+                TestTrue(FString::Printf(TEXT("%s: max deviation %.4f <= bound %.4f"), *Context, MaxDeviation, Bound), MaxDeviation <= Bound + UE_KINDA_SMALL_NUMBER);
+            }
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLuxPathCodecLinearSplineTest, "Lux.Payload.PathCodec.LinearSpline", LuxPayloadTests::TestFlags)
+
+bool FLuxPathCodecLinearSplineTest::RunTest(const FString& Parameters)
+{
+    // GlacialPath 와 같이 선형 스플라인으로 이으면, 스플라인은 복원된 폴리라인과 일치하므로 같은 편차 한계를 따릅니다.
+    FPayload_PathData Original;
+    Original.PathPoints = LuxPathCodec::MakeHillPath(3, 240);
+    Original.Precision = ELuxVectorPrecision::Quantize10;
+    Original.Simplify(2.0);
+
+    FPayload_PathData Decoded;
+    TestTrue(TEXT("Round trip succeeds"), LuxPayloadTests::RoundTrip(Original, Decoded));
+
+    USplineComponent* Spline = NewObject<USplineComponent>(GetTransientPackage());
+    Spline->ClearSplinePoints();
+    for (int32 i = 0; i < Decoded.PathPoints.Num(); ++i)
+    {
+        Spline->AddSplinePoint(Decoded.PathPoints[i], ESplineCoordinateSpace::World, false);
+        Spline->SetSplinePointType(i, ESplinePointType::Linear, false);
+    }
+    Spline->UpdateSpline();
+
+    for (int32 i = 0; i + 1 < Decoded.PathPoints.Num(); ++i)
+    {
+        for (const float Alpha : { 0.25f, 0.5f, 0.75f })
+        {
+            const FVector OnSpline = Spline->GetLocationAtSplineInputKey(i + Alpha, ESplineCoordinateSpace::World);
+            const FVector OnSegment = FMath::Lerp(Decoded.PathPoints[i], Decoded.PathPoints[i + 1], static_cast<double>(Alpha));
+            TestTrue(FString::Printf(TEXT("Segment %d at %.2f stays on the polyline"), i, Alpha), OnSpline.Equals(OnSegment, 0.01));
+        }
+    }
+
+    const double Bound = 2.0 + LuxPathCodec::GetQuantizationError(ELuxVectorPrecision::Quantize10);
+    TestTrue(TEXT("Max deviation stays within bound"), LuxPathCodec::MeasureMaxDeviation(Original.PathPoints, Decoded.PathPoints) <= Bound + UE_KINDA_SMALL_NUMBER);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLuxPathCodecMalformedTest, "Lux.Payload.PathCodec.RejectsMalformed", LuxPayloadTests::TestFlags)
+
+bool FLuxPathCodecMalformedTest::RunTest(const FString& Parameters)
+{
+    // 허용 개수를 넘는 점 개수를 받으면 버퍼를 할당하지 않고 실패해야 합니다.
+    FBitWriter Writer(0, true);
+    uint8 PrecisionValue = static_cast<uint8>(ELuxVectorPrecision::Quantize10);
+    LuxPayloadQuantization::SerializePrecision(Writer, PrecisionValue);
+    uint32 NumPoints = LuxPayloadQuantization::MaxNetPathPoints + 1;
+    Writer.SerializeIntPacked(NumPoints);
+
+    FPayload_PathData Decoded;
+    bool bSuccess = true;
+    FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+    Decoded.NetSerialize(Reader, nullptr, bSuccess);
+
+    TestFalse(TEXT("Oversized point count is rejected"), bSuccess);
+    TestEqual(TEXT("No points are kept"), Decoded.PathPoints.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLuxVectorPayloadRoundTripTest, "Lux.Payload.Quantization.VectorRoundTrip", LuxPayloadTests::TestFlags)
+
+bool FLuxVectorPayloadRoundTripTest::RunTest(const FString& Parameters)
+{
+    FRandomStream Random(22);
+
+    // 기본 정밀도는 단위 방향을 포함한 어떤 값도 그대로 보존해야 합니다.
+    TestTrue(TEXT("Default precision is Full"), FPayload_Vector().Precision == ELuxVectorPrecision::Full);
+
+    for (int32 Sample = 0; Sample < 256; ++Sample)
+    {
+        const FVector Position(Random.FRandRange(-200000.0, 200000.0), Random.FRandRange(-200000.0, 200000.0), Random.FRandRange(-20000.0, 20000.0));
+        const FVector Direction = Random.GetUnitVector();
+
+        {
+            FPayload_Vector Original;
+            Original.Value = Direction;
+
+            FPayload_Vector Decoded;
+            TestTrue(TEXT("Full: round trip succeeds"), LuxPayloadTests::RoundTrip(Original, Decoded));
+            TestEqual(TEXT("Full: direction is exact"), Decoded.Value, Direction);
+        }
+
+        // 위치 정밀도는 격자 반올림 오차 이내여야 합니다.
+        const ELuxVectorPrecision PositionPrecisions[] = { ELuxVectorPrecision::Quantize, ELuxVectorPrecision::Quantize10, ELuxVectorPrecision::Quantize100 };
+        for (const ELuxVectorPrecision Precision : PositionPrecisions)
+        {
+            FPayload_Vector Original;
+            Original.Value = Position;
+            Original.Precision = Precision;
+
+            FPayload_Vector Decoded;
+            const bool bSuccess = LuxPayloadTests::RoundTrip(Original, Decoded);
+            const double Error = FVector::Dist(Position, Decoded.Value);
+            const double Bound = LuxPathCodec::GetQuantizationError(Precision);
+
+            TestTrue(FString::Printf(TEXT("%s: round trip succeeds"), *UEnum::GetValueAsString(Precision)), bSuccess);
+            TestTrue(FString::Printf(TEXT("%s: precision is preserved"), *UEnum::GetValueAsString(Precision)), Decoded.Precision == Precision);
+            TestTrue(FString::Printf(TEXT("%s: error %.6f <= %.6f"), *UEnum::GetValueAsString(Precision), Error, Bound), Error <= Bound + UE_KINDA_SMALL_NUMBER);
+        }
+
+        // Normal 은 축당 16비트 고정 소수점이므로 축마다 한 칸(1/32767) 이내여야 합니다.
+        {
+            FPayload_Vector Original;
+            Original.Value = Direction;
+            Original.Precision = ELuxVectorPrecision::Normal;
+
+            FPayload_Vector Decoded;
+            const bool bSuccess = LuxPayloadTests::RoundTrip(Original, Decoded);
+            const double Error = FVector::Dist(Direction, Decoded.Value);
+            const double Bound = UE_SQRT_3 / 32767.0;
+
+            TestTrue(TEXT("Normal: round trip succeeds"), bSuccess);
+            TestTrue(FString::Printf(TEXT("Normal: error %.8f <= %.8f"), Error, Bound), Error <= Bound);
+            TestTrue(TEXT("Normal: stays unit length"), FMath::IsNearlyEqual(Decoded.Value.Size(), 1.0, 1.0e-3));
+        }
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FLuxRotatorPayloadRoundTripTest, "Lux.Payload.Quantization.RotatorRoundTrip", LuxPayloadTests::TestFlags)
+
+bool FLuxRotatorPayloadRoundTripTest::RunTest(const FString& Parameters)
+{
+    FRandomStream Random(22);
+
+    for (int32 Sample = 0; Sample < 256; ++Sample)
+    {
+        const FRotator Rotation(Random.FRandRange(-90.0, 90.0), Random.FRandRange(-180.0, 180.0), Random.FRandRange(-180.0, 180.0));
+
+        // 각 정밀도의 반 칸 크기가 축당 최대 오차입니다.
+        const TPair<ELuxRotatorPrecision, double> Cases[] =
+        {
+            { ELuxRotatorPrecision::Full, UE_KINDA_SMALL_NUMBER },
+            { ELuxRotatorPrecision::Short, 180.0 / 65536.0 + UE_KINDA_SMALL_NUMBER },
+            { ELuxRotatorPrecision::Byte, 180.0 / 256.0 + UE_KINDA_SMALL_NUMBER },
+        };
+
+        for (const TPair<ELuxRotatorPrecision, double>& Case : Cases)
+        {
+            FPayload_Rotator Original;
+            Original.Value = Rotation;
+            Original.Precision = Case.Key;
+
+            FPayload_Rotator Decoded;
+            const bool bSuccess = LuxPayloadTests::RoundTrip(Original, Decoded);
+
+            TestTrue(FString::Printf(TEXT("%s: round trip succeeds"), *UEnum::GetValueAsString(Case.Key)), bSuccess);
+            TestTrue(FString::Printf(TEXT("%s: %s ~= %s"), *UEnum::GetValueAsString(Case.Key), *Rotation.ToString(), *Decoded.Value.ToString()),
+                Decoded.Value.Equals(Rotation, Case.Value));
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -37,14 +37,33 @@ ULuxAttributeSet::ULuxAttributeSet()
 
 }
 
+FLuxAttribute::FLuxAttribute(const FLuxAttributeInfo& InInfo)
+    : Attribute(InInfo.Property)
+    , CachedInfo(&InInfo)
+{
+}
+
 bool FLuxAttribute::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
     Ar << Attribute;
 
+    if (Ar.IsLoading())
+    {
+        CachedInfo = nullptr;
+    }
+
     bOutSuccess = true;
     return true;
 }
 
+void FLuxAttribute::PostSerialize(const FArchive& Ar)
+{
+    if (Ar.IsLoading())
+    {
+        CachedInfo = nullptr;
+    }
+}
+
 void ULuxAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -69,6 +88,14 @@ UActionSystemComponent* ULuxAttributeSet::GetOwningActionSystemComponentChecked(
     return ASC;
 }
 
+void ULuxAttributeSet::NotifyAttributeReplicated(const FLuxAttribute& Attribute) const
+{
+    if (UActionSystemComponent* ASC = GetOwningActionSystemComponent())
+    {
+        ASC->NotifyAttributeValueChanged(Attribute);
+    }
+}
+
 bool FLuxAttribute::IsValid() const
 {
     return Attribute.Get() != nullptr;
@@ -86,23 +113,40 @@ UClass* FLuxAttribute::GetAttributeSetClass() const
     return Attribute->GetOwner<UClass>();
 }
 
-const FLuxAttributeData* FLuxAttribute::GetAttributeData(const ULuxAttributeSet* Src) const
+int32 FLuxAttribute::GetAttributeId() const
 {
-    if (!FLuxAttribute::IsValid() || !Src) 
-        return nullptr;
+    const FLuxAttributeInfo* Info = GetAttributeInfo();
+    return Info ? Info->Id : INDEX_NONE;
+}
 
-    FStructProperty* StructProperty = CastField<FStructProperty>(Attribute.Get());
-    if (!StructProperty)
+const FLuxAttributeInfo* FLuxAttribute::GetAttributeInfo() const
+{
+#if WITH_EDITOR
+    // 에디터에서는 디테일 패널이 리플렉션으로 경로를 바꿀 수 있으므로 캐시가 가리키는 프로퍼티와 비교합니다.
+    if (CachedInfo && CachedInfo->Property != Attribute.Get())
     {
-        return nullptr;
+        CachedInfo = nullptr;
     }
+#endif
 
-    if (StructProperty->Struct != FLuxAttributeData::StaticStruct())
+    if (!CachedInfo)
     {
-        return nullptr;
+        // 캐시가 비어 있을 때만 경로를 해석하고 레지스트리를 조회합니다. 여러 스레드가 동시에 채워도 같은 값을 기록합니다.
+        FLuxAttributeRegistry& Registry = FLuxAttributeRegistry::Get();
+        CachedInfo = Registry.GetAttributeInfo(Registry.GetAttributeId(Attribute.Get()));
     }
 
-    return StructProperty->ContainerPtrToValuePtr<FLuxAttributeData>(Src);
+    return CachedInfo;
+}
+
+const FLuxAttributeData* FLuxAttribute::GetAttributeData(const ULuxAttributeSet* Src) const
+{
+    if (!Src)
+        return nullptr;
+
+    // 레지스트리에 등록된 FLuxAttributeData 프로퍼티만 유효하며, 캐시된 오프셋으로 직접 접근합니다.
+    const FLuxAttributeInfo* Info = GetAttributeInfo();
+    return Info ? FLuxAttributeRegistry::GetAttributeData(Src, *Info) : nullptr;
 }
 
 const FLuxAttributeData* FLuxAttribute::GetAttributeDataChecked(const ULuxAttributeSet* Src) const
@@ -115,21 +159,11 @@ const FLuxAttributeData* FLuxAttribute::GetAttributeDataChecked(const ULuxAttrib
 
 FLuxAttributeData* FLuxAttribute::GetAttributeData(ULuxAttributeSet* Src) const
 {
-    if (!FLuxAttribute::IsValid() || !Src)
-        return nullptr;
-
-    FStructProperty* StructProperty = CastField<FStructProperty>(Attribute.Get());
-    if (!StructProperty)
-    {
+    if (!Src)
         return nullptr;
-    }
 
-    if (StructProperty->Struct != FLuxAttributeData::StaticStruct())
-    {
-        return nullptr;
-    }
-
-    return StructProperty->ContainerPtrToValuePtr<FLuxAttributeData>(Src);
+    const FLuxAttributeInfo* Info = GetAttributeInfo();
+    return Info ? FLuxAttributeRegistry::GetAttributeData(Src, *Info) : nullptr;
 }
 
 FLuxAttributeData* FLuxAttribute::GetAttributeDataChecked(ULuxAttributeSet* Src) const
@@ -143,4 +177,123 @@ FLuxAttributeData* FLuxAttribute::GetAttributeDataChecked(ULuxAttributeSet* Src)
 bool FLuxAttribute::operator==(const FLuxAttribute& Other) const
 {
     return Attribute == Other.Attribute;
-}
\ No newline at end of file
+}
+//--------------------------------------------------------------------------------------------------------------
+
+FLuxAttributeRegistry& FLuxAttributeRegistry::Get()
+{
+    static FLuxAttributeRegistry Registry;
+    return Registry;
+}
+
+void FLuxAttributeRegistry::RegisterAllAttributeSetClasses()
+{
+    TArray<UClass*> AttributeSetClasses;
+    GetDerivedClasses(ULuxAttributeSet::StaticClass(), AttributeSetClasses, true);
+
+    FRWScopeLock WriteLock(RegistryLock, FRWScopeLockType::SLT_Write);
+    for (const UClass* AttributeSetClass : AttributeSetClasses)
+    {
+        RegisterClass_Locked(AttributeSetClass);
+    }
+}
+
+const TArray<int32>& FLuxAttributeRegistry::GetAttributeIdsForClass(const UClass* AttributeSetClass)
+{
+    {
+        FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+        if (const TUniquePtr<TArray<int32>>* Ids = ClassToIds.Find(AttributeSetClass))
+        {
+            return **Ids;
+        }
+    }
+
+    FRWScopeLock WriteLock(RegistryLock, FRWScopeLockType::SLT_Write);
+    return RegisterClass_Locked(AttributeSetClass);
+}
+
+int32 FLuxAttributeRegistry::GetAttributeId(const FProperty* Property)
+{
+    if (!Property)
+    {
+        return INDEX_NONE;
+    }
+
+    {
+        FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+        if (const int32* Id = PropertyToId.Find(Property))
+        {
+            return *Id;
+        }
+    }
+
+    // 소유 클래스가 아직 등록되지 않았다면 한 번 등록한 뒤 다시 조회합니다.
+    const UClass* OwnerClass = Property->GetOwner<UClass>();
+    if (!OwnerClass || !OwnerClass->IsChildOf(ULuxAttributeSet::StaticClass()))
+    {
+        return INDEX_NONE;
+    }
+
+    FRWScopeLock WriteLock(RegistryLock, FRWScopeLockType::SLT_Write);
+    RegisterClass_Locked(OwnerClass);
+
+    const int32* Id = PropertyToId.Find(Property);
+    return Id ? *Id : INDEX_NONE;
+}
+
+const FLuxAttributeInfo* FLuxAttributeRegistry::GetAttributeInfo(int32 AttributeId) const
+{
+    FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+    return Attributes.IsValidIndex(AttributeId) ? &Attributes[AttributeId] : nullptr;
+}
+
+int32 FLuxAttributeRegistry::Num() const
+{
+    FRWScopeLock ReadLock(RegistryLock, FRWScopeLockType::SLT_ReadOnly);
+    return Attributes.Num();
+}
+
+const TArray<int32>& FLuxAttributeRegistry::RegisterClass_Locked(const UClass* AttributeSetClass)
+{
+    if (const TUniquePtr<TArray<int32>>* ExistingIds = ClassToIds.Find(AttributeSetClass))
+    {
+        return **ExistingIds;
+    }
+
+    TArray<int32>& Ids = *ClassToIds.Add(AttributeSetClass, MakeUnique<TArray<int32>>());
+    if (!AttributeSetClass)
+    {
+        return Ids;
+    }
+
+    for (TFieldIterator<FStructProperty> PropIt(AttributeSetClass, EFieldIterationFlags::IncludeSuper); PropIt; ++PropIt)
+    {
+        FStructProperty* StructProp = *PropIt;
+        if (StructProp->Struct != FLuxAttributeData::StaticStruct())
+        {
+            continue;
+        }
+
+        // 부모 클래스에 선언된 속성은 부모 클래스와 같은 ID 를 공유합니다.
+        int32 Id = INDEX_NONE;
+        if (const int32* ExistingId = PropertyToId.Find(StructProp))
+        {
+            Id = *ExistingId;
+        }
+        else
+        {
+            FLuxAttributeInfo* Info = new FLuxAttributeInfo();
+            Info->Id = Attributes.Add(Info);
+            Info->Offset = StructProp->GetOffset_ForInternal();
+            Info->OwnerClass = StructProp->GetOwner<UClass>();
+            Info->Property = StructProp;
+
+            Id = Info->Id;
+            PropertyToId.Add(StructProp, Id);
+        }
+
+        Ids.Add(Id);
+    }
+
+    return Ids;
+}
@@ -9,6 +9,7 @@
 struct FLuxModCallbackData;
 struct FLuxEffectSpec;
 struct FAttributeModifier;
+struct FLuxAttributeInfo;
 class UActionSystemComponent;
 
 /**
@@ -85,6 +86,9 @@ public:
         Attribute = TFieldPath<FProperty>(InProperty);
     }
 
+    /** 레지스트리에 등록된 속성 정보로부터 생성합니다. 정보가 미리 캐시되므로 이후 조회에서 레지스트리를 거치지 않습니다. */
+    explicit FLuxAttribute(const FLuxAttributeInfo& InInfo);
+
     /** 이 Attribute가 유효한 프로퍼티를 가리키고 있는지 확인합니다 */
 	bool IsValid() const;
 
@@ -104,6 +108,12 @@ public:
 	FLuxAttributeData* GetAttributeData(ULuxAttributeSet* Src) const;
 	FLuxAttributeData* GetAttributeDataChecked(ULuxAttributeSet* Src) const;
 
+    /** FLuxAttributeRegistry 에 등록된 이 속성의 고유 ID 를 반환합니다. 유효하지 않으면 INDEX_NONE 을 반환합니다. */
+    int32 GetAttributeId() const;
+
+    /** 이 속성의 레지스트리 정보를 반환합니다. 처음 호출될 때 한 번만 레지스트리에서 조회하고 이후에는 캐시를 사용합니다. */
+    const FLuxAttributeInfo* GetAttributeInfo() const;
+
     /** 속성의 이름을 FName으로 반환합니다. */
     FName GetName() const
     {
@@ -117,18 +127,96 @@ public:
 
 	bool operator==(const FLuxAttribute& Other) const;
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	void PostSerialize(const FArchive& Ar);
 
 protected:
 	friend class FLuxAttributeCustomization;
 
 	UPROPERTY(Category = LuxAttribute, EditAnywhere, meta = (AllowPrivateAccess))
 	TFieldPath<FProperty> Attribute;
+
+private:
+	/**
+	 * 레지스트리에서 조회한 속성 정보 캐시입니다. 정보는 개별 할당되어 주소가 바뀌지 않으므로,
+	 * 한 번 채워진 뒤에는 TFieldPath 해석, 레지스트리 락, 맵 조회 없이 오프셋에 접근할 수 있습니다.
+	 * 경로가 역직렬화로 바뀌면 비웁니다.
+	 */
+	mutable const FLuxAttributeInfo* CachedInfo = nullptr;
 };
 
 template<>
 struct TStructOpsTypeTraits<FLuxAttribute> : public TStructOpsTypeTraitsBase2<FLuxAttribute>
 {
-	enum { WithNetSerializer = true };
+	enum
+	{
+		WithNetSerializer = true,
+		WithPostSerialize = true,
+	};
+};
+
+
+/** FLuxAttributeRegistry 에 등록된 단일 속성의 정보입니다. */
+struct FLuxAttributeInfo
+{
+    /** 모든 AttributeSet 클래스에 걸쳐 고유한 연속(Dense) ID */
+    int32 Id = INDEX_NONE;
+
+    /** AttributeSet 인스턴스 시작 주소로부터 FLuxAttributeData 까지의 바이트 오프셋 */
+    int32 Offset = 0;
+
+    /** 이 속성을 선언한 AttributeSet 클래스 */
+    UClass* OwnerClass = nullptr;
+
+    /** 원본 프로퍼티 (FLuxAttribute 를 재구성할 때 사용) */
+    FStructProperty* Property = nullptr;
+};
+
+/**
+ * @class FLuxAttributeRegistry
+ * @brief 모든 ULuxAttributeSet 파생 클래스의 FLuxAttributeData 프로퍼티를 연속 ID 와 바이트 오프셋으로 매핑하는 전역 레지스트리입니다.
+ * 클래스당 한 번만 리플렉션으로 구성되며, 이후 속성 데이터 접근은 오프셋 기반의 단순 메모리 접근으로 처리됩니다.
+ */
+class LUX_API FLuxAttributeRegistry
+{
+public:
+    static FLuxAttributeRegistry& Get();
+
+    /** 현재 로드된 모든 ULuxAttributeSet 파생 클래스를 등록합니다. (게임 시작 시 한 번 호출) */
+    void RegisterAllAttributeSetClasses();
+
+    /** 지정한 AttributeSet 클래스의 속성 ID 목록을 반환합니다. 처음 호출될 때 한 번만 구성합니다. (부모 클래스 속성 포함) */
+    const TArray<int32>& GetAttributeIdsForClass(const UClass* AttributeSetClass);
+
+    /** 프로퍼티에 해당하는 속성 ID 를 반환합니다. 소유 클래스가 아직 등록되지 않았다면 등록합니다. */
+    int32 GetAttributeId(const FProperty* Property);
+
+    /** ID 에 해당하는 속성 정보를 반환합니다. */
+    const FLuxAttributeInfo* GetAttributeInfo(int32 AttributeId) const;
+
+    /** 등록된 전체 속성 수를 반환합니다. ID 는 [0, Num) 범위입니다. */
+    int32 Num() const;
+
+    /** AttributeSet 인스턴스에서 오프셋으로 속성 데이터를 직접 가져옵니다. */
+    static FORCEINLINE FLuxAttributeData* GetAttributeData(ULuxAttributeSet* Set, const FLuxAttributeInfo& Info)
+    {
+        return reinterpret_cast<FLuxAttributeData*>(reinterpret_cast<uint8*>(Set) + Info.Offset);
+    }
+
+    static FORCEINLINE const FLuxAttributeData* GetAttributeData(const ULuxAttributeSet* Set, const FLuxAttributeInfo& Info)
+    {
+        return reinterpret_cast<const FLuxAttributeData*>(reinterpret_cast<const uint8*>(Set) + Info.Offset);
+    }
+
+private:
+    /** 클래스를 등록합니다. 호출자는 쓰기 락을 보유하고 있어야 합니다. */
+    const TArray<int32>& RegisterClass_Locked(const UClass* AttributeSetClass);
+
+    // 반환된 포인터/참조가 등록 도중에도 유효하도록 요소를 개별 할당합니다.
+    TIndirectArray<FLuxAttributeInfo> Attributes;
+    TMap<const FProperty*, int32> PropertyToId;
+    TMap<const UClass*, TUniquePtr<TArray<int32>>> ClassToIds;
+
+    mutable FRWLock RegistryLock;
 };
 
 /**
@@ -165,6 +253,9 @@ public:
 	UActionSystemComponent* GetOwningActionSystemComponent() const;
 	UActionSystemComponent* GetOwningActionSystemComponentChecked() const;
 
+	/** 복제로 속성 값이 바뀌었음을 소유 ASC 에 알립니다. (LUXATTRIBUTE_REPNOTIFY 에서 호출) */
+	void NotifyAttributeReplicated(const FLuxAttribute& Attribute) const;
+
 	/** 이펙트가 속성에 적용되기 직전에 호출됩니다. 전체 이펙트 적용을 막을 수 있습니다. */
 	virtual bool PreLuxEffectExecute(FLuxModCallbackData& Data) { return true; }
 
@@ -280,6 +371,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FLuxAttributeChanged,
 		{ \
 			const float OldValue_ = OldValue.GetCurrentValue(); \
 			const float NewValue_ = Get##PropertyName(); \
+			NotifyAttributeReplicated(FLuxAttribute(Prop)); \
 			On##PropertyName##Changed.Broadcast(OldValue_, NewValue_); \
 		} \
 	}
\ No newline at end of file
@@ -3,3 +3,8 @@
 
 #include "ActionSystem/Effects/LuxEffect.h"
 #include "ActionSystem/ActionSystemComponent.h"
+
+const FLuxCompiledTagQuery& ULuxEffect::GetApplicationTagQuery() const
+{
+    return ApplicationTagQuery.GetOrCompile(ApplicationRequiredTags, FGameplayTagContainer::EmptyContainer, ApplicationBlockedTags);
+}
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "GameplayTagContainer.h"
+#include "System/GameplayTagStack.h"
 
 #include "LuxEffectTypes.h"
 #include "LuxEffect.generated.h"
@@ -79,4 +80,12 @@ public:
 
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Effect|UI")
     TSoftObjectPtr<UTexture2D> Icon;
+
+public:
+    /** ApplicationRequiredTags(RequireAll)와 ApplicationBlockedTags(RequireNone)를 컴파일한 질의를 반환합니다. */
+    const FLuxCompiledTagQuery& GetApplicationTagQuery() const;
+
+private:
+    /** 적용 조건 질의 캐시입니다. 이펙트 템플릿은 CDO 로 공유되므로 처음 사용할 때 한 번만 컴파일합니다. */
+    FLuxCompiledTagQuery ApplicationTagQuery;
 };
\ No newline at end of file
@@ -0,0 +1,278 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ActionSystem/Effects/LuxEffectScheduler.h"
+
+
+FLuxEffectScheduler::FLuxEffectScheduler(float InBucketSeconds, int32 InNumBuckets)
+	: BucketSeconds(FMath::Max(InBucketSeconds, KINDA_SMALL_NUMBER))
+	, NumBuckets(FMath::Max(InNumBuckets, 1))
+{
+	Buckets.SetNum(NumBuckets);
+}
+
+void FLuxEffectScheduler::ScheduleExpiration(const FActiveLuxEffectHandle& Handle, float FireTime)
+{
+	FEffectEntries& Slots = EffectEntries.FindOrAdd(Handle);
+	CancelEntry(Slots.ExpirationId);
+
+	const int32 EntryId = AllocateEntry();
+	FEntry& Entry = Entries[EntryId];
+	Entry.Handle = Handle;
+	Entry.Event = ELuxScheduledEffectEvent::Expiration;
+	Entry.FireTime = FireTime;
+	Entry.Period = 0.f;
+
+	Slots.ExpirationId = EntryId;
+	InsertEntry(EntryId);
+
+	++Stats.NumPending;
+	++Stats.TotalScheduled;
+}
+
+void FLuxEffectScheduler::SchedulePeriod(const FActiveLuxEffectHandle& Handle, float FirstFireTime, float Period)
+{
+	if (Period <= 0.f)
+	{
+		return;
+	}
+
+	FEffectEntries& Slots = EffectEntries.FindOrAdd(Handle);
+	CancelEntry(Slots.PeriodId);
+
+	const int32 EntryId = AllocateEntry();
+	FEntry& Entry = Entries[EntryId];
+	Entry.Handle = Handle;
+	Entry.Event = ELuxScheduledEffectEvent::Period;
+	Entry.FireTime = FirstFireTime;
+	Entry.Period = Period;
+
+	Slots.PeriodId = EntryId;
+	InsertEntry(EntryId);
+
+	++Stats.NumPending;
+	++Stats.TotalScheduled;
+}
+
+void FLuxEffectScheduler::CancelExpiration(const FActiveLuxEffectHandle& Handle)
+{
+	if (FEffectEntries* Slots = EffectEntries.Find(Handle))
+	{
+		CancelEntry(Slots->ExpirationId);
+		if (Slots->PeriodId == INDEX_NONE)
+		{
+			EffectEntries.Remove(Handle);
+		}
+	}
+}
+
+void FLuxEffectScheduler::CancelPeriod(const FActiveLuxEffectHandle& Handle)
+{
+	if (FEffectEntries* Slots = EffectEntries.Find(Handle))
+	{
+		CancelEntry(Slots->PeriodId);
+		if (Slots->ExpirationId == INDEX_NONE)
+		{
+			EffectEntries.Remove(Handle);
+		}
+	}
+}
+
+void FLuxEffectScheduler::CancelAll(const FActiveLuxEffectHandle& Handle)
+{
+	if (FEffectEntries* Slots = EffectEntries.Find(Handle))
+	{
+		CancelEntry(Slots->ExpirationId);
+		CancelEntry(Slots->PeriodId);
+		EffectEntries.Remove(Handle);
+	}
+}
+
+bool FLuxEffectScheduler::HasExpiration(const FActiveLuxEffectHandle& Handle) const
+{
+	const FEffectEntries* Slots = EffectEntries.Find(Handle);
+	return Slots && Slots->ExpirationId != INDEX_NONE;
+}
+
+void FLuxEffectScheduler::Advance(float Now, TArray<FLuxScheduledEffectFire>& OutFired)
+{
+	OutFired.Reset();
+	Stats.LastFrameFired = 0;
+
+	const int64 NowTick = TimeToTick(Now);
+	if (CursorTick == INDEX_NONE)
+	{
+		CursorTick = NowTick;
+	}
+
+	if (Stats.NumPending == 0 && FreeEntryIds.Num() == Entries.Num())
+	{
+		CursorTick = NowTick;
+		return;
+	}
+
+	// 지나간 틱의 버킷만 확인합니다. 한 바퀴 이상 지났다면 모든 버킷을 한 번씩만 확인하면 충분합니다.
+	const int64 NumTicksToScan = FMath::Min<int64>(NowTick - CursorTick + 1, NumBuckets);
+	DueEntryIds.Reset();
+
+	for (int64 TickOffset = 0; TickOffset < NumTicksToScan; ++TickOffset)
+	{
+		TArray<int32>& Bucket = Buckets[static_cast<int32>((CursorTick + TickOffset) % NumBuckets)];
+		for (int32 BucketIndex = Bucket.Num() - 1; BucketIndex >= 0; --BucketIndex)
+		{
+			const int32 EntryId = Bucket[BucketIndex];
+			const FEntry& Entry = Entries[EntryId];
+
+			if (!Entry.bActive)
+			{
+				// 취소된 항목은 여기서 풀에 반환합니다.
+				Bucket.RemoveAtSwap(BucketIndex, 1, EAllowShrinking::No);
+				FreeEntryIds.Add(EntryId);
+			}
+			else if (Entry.FireTime <= Now)
+			{
+				Bucket.RemoveAtSwap(BucketIndex, 1, EAllowShrinking::No);
+				DueEntryIds.Add(EntryId);
+			}
+		}
+	}
+
+	CursorTick = NowTick;
+
+	// 결정적인 실행 순서를 위해 정렬합니다. 주기 이벤트는 다음 실행 시각으로 재삽입하면서 순서를 유지합니다.
+	DueEntryIds.Sort([this](int32 A, int32 B) { return FireOrder(Entries[A], Entries[B]); });
+
+	for (int32 DueIndex = 0; DueIndex < DueEntryIds.Num(); ++DueIndex)
+	{
+		const int32 EntryId = DueEntryIds[DueIndex];
+		FEntry& Entry = Entries[EntryId];
+
+		FLuxScheduledEffectFire& Fired = OutFired.AddDefaulted_GetRef();
+		Fired.Handle = Entry.Handle;
+		Fired.Event = Entry.Event;
+		++Stats.LastFrameFired;
+
+		if (Entry.Event == ELuxScheduledEffectEvent::Expiration)
+		{
+			++Stats.TotalExpirationsFired;
+			--Stats.NumPending;
+			Entry.bActive = false;
+			FreeEntryIds.Add(EntryId);
+
+			if (FEffectEntries* Slots = EffectEntries.Find(Entry.Handle))
+			{
+				Slots->ExpirationId = INDEX_NONE;
+				if (Slots->PeriodId == INDEX_NONE)
+				{
+					EffectEntries.Remove(Entry.Handle);
+				}
+			}
+			continue;
+		}
+
+		++Stats.TotalPeriodsFired;
+		Entry.FireTime += Entry.Period;
+		Entry.Sequence = NextSequence++;
+
+		if (Entry.FireTime <= Now)
+		{
+			// 한 프레임에 여러 주기가 지났다면 남은 실행 목록에 순서대로 다시 끼워 넣습니다.
+			int32 InsertIndex = DueIndex + 1;
+			while (InsertIndex < DueEntryIds.Num() && FireOrder(Entries[DueEntryIds[InsertIndex]], Entry))
+			{
+				++InsertIndex;
+			}
+			DueEntryIds.Insert(EntryId, InsertIndex);
+		}
+		else
+		{
+			InsertEntry(EntryId);
+		}
+	}
+}
+
+void FLuxEffectScheduler::Reset()
+{
+	for (TArray<int32>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+
+	Stats.TotalCancelled += Stats.NumPending;
+	Stats.NumPending = 0;
+
+	Entries.Reset();
+	FreeEntryIds.Reset();
+	EffectEntries.Reset();
+	DueEntryIds.Reset();
+	CursorTick = INDEX_NONE;
+}
+
+int32 FLuxEffectScheduler::AllocateEntry()
+{
+	int32 EntryId;
+	if (FreeEntryIds.Num() > 0)
+	{
+		EntryId = FreeEntryIds.Pop(EAllowShrinking::No);
+		Entries[EntryId] = FEntry();
+	}
+	else
+	{
+		EntryId = Entries.AddDefaulted();
+	}
+
+	Entries[EntryId].bActive = true;
+	Entries[EntryId].Sequence = NextSequence++;
+	return EntryId;
+}
+
+void FLuxEffectScheduler::InsertEntry(int32 EntryId)
+{
+	// 이미 처리한 틱보다 이른 시각은 현재 커서 버킷에 넣어 다음 Advance 에서 바로 실행되도록 합니다.
+	int64 Tick = TimeToTick(Entries[EntryId].FireTime);
+	if (CursorTick != INDEX_NONE && Tick < CursorTick)
+	{
+		Tick = CursorTick;
+	}
+
+	Buckets[static_cast<int32>(Tick % NumBuckets)].Add(EntryId);
+}
+
+void FLuxEffectScheduler::CancelEntry(int32& EntryId)
+{
+	if (EntryId == INDEX_NONE)
+	{
+		return;
+	}
+
+	// 버킷에서는 지연 제거되며, 해당 버킷을 지날 때 풀로 반환됩니다.
+	if (Entries.IsValidIndex(EntryId) && Entries[EntryId].bActive)
+	{
+		Entries[EntryId].bActive = false;
+		--Stats.NumPending;
+		++Stats.TotalCancelled;
+	}
+
+	EntryId = INDEX_NONE;
+}
+
+int64 FLuxEffectScheduler::TimeToTick(float Time) const
+{
+	return FMath::Max<int64>(0, FMath::FloorToInt64(Time / BucketSeconds));
+}
+
+bool FLuxEffectScheduler::FireOrder(const FEntry& A, const FEntry& B)
+{
+	if (A.FireTime != B.FireTime)
+	{
+		return A.FireTime < B.FireTime;
+	}
+
+	// 같은 시각이면 마지막 주기 틱이 만료보다 먼저 실행되도록 합니다.
+	if (A.Event != B.Event)
+	{
+		return A.Event < B.Event;
+	}
+
+	return A.Sequence < B.Sequence;
+}
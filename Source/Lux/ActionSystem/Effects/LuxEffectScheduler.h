@@ -0,0 +1,135 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ActionSystem/Effects/LuxEffectTypes.h"
+
+/** 이펙트 스케줄러가 발생시키는 이벤트의 종류입니다. 같은 시각에 예약된 경우 값이 작은 쪽이 먼저 실행됩니다. */
+enum class ELuxScheduledEffectEvent : uint8
+{
+	/** 주기적(Periodic) 실행 */
+	Period,
+
+	/** 지속 시간 만료 */
+	Expiration,
+};
+
+/** 이번 프레임에 실행 시각에 도달한 단일 이벤트입니다. */
+struct FLuxScheduledEffectFire
+{
+	FActiveLuxEffectHandle Handle;
+	ELuxScheduledEffectEvent Event = ELuxScheduledEffectEvent::Expiration;
+};
+
+/** 이펙트 스케줄러의 누적 통계입니다. */
+struct FLuxEffectSchedulerStats
+{
+	/** 현재 예약되어 있는 이벤트 수 */
+	int32 NumPending = 0;
+
+	/** 지금까지 예약된 이벤트 수 (주기 재예약 제외) */
+	uint64 TotalScheduled = 0;
+
+	/** 지금까지 실행된 만료 이벤트 수 */
+	uint64 TotalExpirationsFired = 0;
+
+	/** 지금까지 실행된 주기 이벤트 수 */
+	uint64 TotalPeriodsFired = 0;
+
+	/** 지금까지 취소된 이벤트 수 */
+	uint64 TotalCancelled = 0;
+
+	/** 마지막 Advance 에서 실행된 이벤트 수 */
+	int32 LastFrameFired = 0;
+};
+
+/**
+ * @class FLuxEffectScheduler
+ * @brief 지속 효과의 만료와 주기 실행을 관리하는 해시 타이밍 휠(Hashed Timing Wheel)입니다.
+ * 이벤트는 실행 시각을 BucketSeconds 단위로 나눈 틱의 버킷에 저장되며, 매 프레임 한 번 Advance 로 지나간 버킷만 확인합니다.
+ * 실행 순서는 (실행 시각, 이벤트 종류, 예약 순서) 로 정렬되어 항상 결정적입니다.
+ */
+class LUX_API FLuxEffectScheduler
+{
+public:
+	explicit FLuxEffectScheduler(float InBucketSeconds = 0.05f, int32 InNumBuckets = 256);
+
+	/** 지정한 시각에 이펙트가 만료되도록 예약합니다. 기존 만료 예약은 대체됩니다. */
+	void ScheduleExpiration(const FActiveLuxEffectHandle& Handle, float FireTime);
+
+	/** 지정한 시각부터 Period 간격으로 이펙트가 실행되도록 예약합니다. 기존 주기 예약은 대체됩니다. */
+	void SchedulePeriod(const FActiveLuxEffectHandle& Handle, float FirstFireTime, float Period);
+
+	/** 만료 예약을 취소합니다. */
+	void CancelExpiration(const FActiveLuxEffectHandle& Handle);
+
+	/** 주기 예약을 취소합니다. */
+	void CancelPeriod(const FActiveLuxEffectHandle& Handle);
+
+	/** 이펙트의 모든 예약을 취소합니다. */
+	void CancelAll(const FActiveLuxEffectHandle& Handle);
+
+	/** 만료 예약이 있는지 확인합니다. */
+	bool HasExpiration(const FActiveLuxEffectHandle& Handle) const;
+
+	/**
+	 * Now 까지 실행 시각에 도달한 이벤트들을 결정적 순서로 수집합니다.
+	 * 주기 이벤트는 다음 실행 시각으로 자동 재예약되며, 여러 주기가 지났다면 그 횟수만큼 수집됩니다.
+	 */
+	void Advance(float Now, TArray<FLuxScheduledEffectFire>& OutFired);
+
+	/** 모든 예약을 제거합니다. (통계는 유지) */
+	void Reset();
+
+	bool IsEmpty() const { return Stats.NumPending == 0; }
+
+	const FLuxEffectSchedulerStats& GetStats() const { return Stats; }
+
+private:
+	struct FEntry
+	{
+		FActiveLuxEffectHandle Handle;
+		ELuxScheduledEffectEvent Event = ELuxScheduledEffectEvent::Expiration;
+		float FireTime = 0.f;
+		float Period = 0.f;
+		uint32 Sequence = 0;
+		bool bActive = false;
+	};
+
+	/** 이펙트 하나가 가진 예약 항목의 인덱스입니다. */
+	struct FEffectEntries
+	{
+		int32 ExpirationId = INDEX_NONE;
+		int32 PeriodId = INDEX_NONE;
+	};
+
+	int32 AllocateEntry();
+	void InsertEntry(int32 EntryId);
+	void CancelEntry(int32& EntryId);
+	int64 TimeToTick(float Time) const;
+	static bool FireOrder(const FEntry& A, const FEntry& B);
+
+	float BucketSeconds;
+	int32 NumBuckets;
+
+	/** 틱 % NumBuckets 로 접근하는 버킷. 각 버킷은 항목 인덱스를 담습니다. */
+	TArray<TArray<int32>> Buckets;
+
+	/** 항목 풀과 재사용 가능한 인덱스 목록입니다. 취소된 항목은 버킷을 지날 때 반환됩니다. */
+	TArray<FEntry> Entries;
+	TArray<int32> FreeEntryIds;
+
+	/** 이펙트 핸들 -> 예약 항목 */
+	TMap<FActiveLuxEffectHandle, FEffectEntries> EffectEntries;
+
+	/** 이번 Advance 에서 실행 시각에 도달한 항목 (재사용 버퍼) */
+	TArray<int32> DueEntryIds;
+
+	/** 마지막으로 처리한 틱입니다. 이 틱의 버킷은 아직 미래 항목을 담고 있을 수 있어 다음 Advance 에서 다시 확인합니다. */
+	int64 CursorTick = INDEX_NONE;
+
+	uint32 NextSequence = 0;
+
+	FLuxEffectSchedulerStats Stats;
+};
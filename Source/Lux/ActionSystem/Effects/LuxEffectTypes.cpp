@@ -207,6 +207,16 @@ bool FLuxEffectContextHandle::operator==(const FLuxEffectContextHandle& Other) c
 	return Context == Other.Context;
 }
 
+FLuxEffectContextHandle FLuxEffectContextHandle::Duplicate() const
+{
+	FLuxEffectContextHandle NewHandle;
+	if (FLuxEffectContextHandle::IsValid())
+	{
+		NewHandle.Context = MakeShared<FLuxEffectContext>(*Context);
+	}
+	return NewHandle;
+}
+
 bool FLuxEffectContextHandle::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
 	uint8 RepBits = 0;
@@ -318,6 +328,7 @@ FLuxEffectSpec::FLuxEffectSpec(const FLuxEffectSpec& Other)
 	, Level(Other.Level)
 	, CalculatedPeriod(Other.CalculatedPeriod)
 	, CalculatedDuration(Other.CalculatedDuration)
+	, bSourceStagePrepared(Other.bSourceStagePrepared)
 {
 }
 
@@ -471,8 +482,28 @@ bool FActiveLuxEffect::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSu
 	return true;
 }
 
+int32 FActiveLuxEffectsContainer::IndexOfHandle(const FActiveLuxEffectHandle& InHandle) const
+{
+	const int32 Index = HandleIndex.Find(InHandle.Handle);
+	if (Items.IsValidIndex(Index) && Items[Index].Handle == InHandle)
+	{
+		return Index;
+	}
+
+	// 클라이언트에서 색인 재구성이 보류 중이라면 원본 배열에서 검색합니다.
+	if (HandleIndex.IsDirty())
+	{
+		return Items.IndexOfByPredicate([&InHandle](const FActiveLuxEffect& Effect) { return Effect.Handle == InHandle; });
+	}
+
+	return INDEX_NONE;
+}
+
 void FActiveLuxEffectsContainer::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize)
 {
+	// 수신이 끝나면 PostReplicatedReceive 에서 색인을 다시 구성합니다.
+	HandleIndex.MarkDirty();
+
 	if (!OwnerComponent.IsValid()) 
 		return;
 
@@ -504,6 +535,9 @@ void FActiveLuxEffectsContainer::PostReplicatedChange(const TArrayView<int32>& C
 
 void FActiveLuxEffectsContainer::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize)
 {
+	// 제거 직후 FastArray 가 항목을 RemoveAtSwap 으로 재배치하므로 수신 완료 시점에 색인을 다시 구성합니다.
+	HandleIndex.MarkDirty();
+
 	if (!OwnerComponent.IsValid())
 		return;
 
@@ -515,4 +549,103 @@ void FActiveLuxEffectsContainer::PreReplicatedRemove(const TArrayView<int32>& Re
 		// 클라이언트에서 쿨다운 맵을 업데이트하도록 합니다.
 		OwnerComponent->OnRep_EffectRemoved(RemovedEffect);
 	}
-}
\ No newline at end of file
+}
+void FActiveLuxEffectsContainer::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	if (!HandleIndex.IsDirty())
+		return;
+
+	if (OwnerComponent.IsValid())
+	{
+		FRWScopeLock WriteLock(OwnerComponent->ActiveLuxEffectsLock, FRWScopeLockType::SLT_Write);
+		HandleIndex.Rebuild(Items, [](const FActiveLuxEffect& Effect) { return Effect.Handle.Handle; });
+	}
+	else
+	{
+		HandleIndex.Rebuild(Items, [](const FActiveLuxEffect& Effect) { return Effect.Handle.Handle; });
+	}
+}
+
+void FLuxAttributeAggregator::AddMod(const FActiveLuxEffectHandle& EffectHandle, EModifierOperation Operation, float Magnitude, int32 Stacks)
+{
+	FAggregatedMod& NewMod = Mods.AddDefaulted_GetRef();
+	NewMod.EffectHandle = EffectHandle;
+	NewMod.Operation = Operation;
+	NewMod.Magnitude = Magnitude;
+	NewMod.Stacks = Stacks;
+	bDirty = true;
+}
+
+void FLuxAttributeAggregator::RemoveMods(const FActiveLuxEffectHandle& EffectHandle)
+{
+	// RemoveAll 은 남은 항목의 순서를 유지합니다.
+	if (Mods.RemoveAll([&EffectHandle](const FAggregatedMod& Mod) { return Mod.EffectHandle == EffectHandle; }) > 0)
+	{
+		bDirty = true;
+	}
+}
+
+void FLuxAttributeAggregator::SetStacks(const FActiveLuxEffectHandle& EffectHandle, int32 NewStacks)
+{
+	for (FAggregatedMod& Mod : Mods)
+	{
+		if (Mod.EffectHandle == EffectHandle && Mod.Stacks != NewStacks)
+		{
+			Mod.Stacks = NewStacks;
+			bDirty = true;
+		}
+	}
+}
+
+float FLuxAttributeAggregator::Evaluate(float BaseValue)
+{
+	if (bDirty)
+	{
+		Rebuild();
+	}
+
+	if (bCachedHasOverride)
+	{
+		return CachedOverride;
+	}
+
+	// 기존 공식과 동일한 연산 순서: Base * Multiplier + Addition
+	float NewValue = BaseValue;
+	NewValue *= CachedMultiplier;
+	NewValue += CachedAddition;
+	return NewValue;
+}
+
+void FLuxAttributeAggregator::Rebuild()
+{
+	CachedMultiplier = 1.0f;
+	CachedAddition = 0.0f;
+	CachedOverride = 0.0f;
+	bCachedHasOverride = false;
+
+	for (const FAggregatedMod& Mod : Mods)
+	{
+		switch (Mod.Operation)
+		{
+		case EModifierOperation::Override:
+			// 마지막으로 적용된 Override 가 우선하며, 스택은 반영하지 않습니다.
+			CachedOverride = Mod.Magnitude;
+			bCachedHasOverride = true;
+			break;
+
+		case EModifierOperation::Multiply:
+			// 1.0f + ( (Magnitude - 1.0f) * 스택 ) 의 덧셈 기반 배율입니다.
+			CachedMultiplier += (Mod.Magnitude - 1.0f) * Mod.Stacks;
+			break;
+
+		case EModifierOperation::Add:
+			CachedAddition += Mod.Magnitude * Mod.Stacks;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	bDirty = false;
+}
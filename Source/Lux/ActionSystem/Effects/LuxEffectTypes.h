@@ -170,6 +170,9 @@ public:
     void SetSourceASC(UActionSystemComponent* InASC);
     void SetSourceAction(const FLuxActionSpecHandle& InHandle);
 
+    /** 같은 내용을 가진 새 컨텍스트를 생성하여 그 핸들을 반환합니다. (대상별로 TargetASC 만 바꿔야 할 때 사용) */
+    FLuxEffectContextHandle Duplicate() const;
+
     bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
 private:
@@ -266,6 +269,32 @@ public:
 
 
 #pragma region Lux Effect
+/**
+ * @struct FLuxEffectTargetResult
+ * @brief ApplyEffectSpecToTargets 의 대상별 적용 결과입니다.
+ */
+USTRUCT(BlueprintType)
+struct FLuxEffectTargetResult
+{
+    GENERATED_BODY()
+
+    /** 적용 대상 */
+    UPROPERTY(BlueprintReadOnly, Category = "Effect")
+    TObjectPtr<UActionSystemComponent> TargetASC = nullptr;
+
+    /** 지속/무한 효과인 경우 대상에 생성된 활성 효과 핸들 */
+    UPROPERTY(BlueprintReadOnly, Category = "Effect")
+    FActiveLuxEffectHandle ActiveHandle;
+
+    /** 이 대상에 적용된 Spec 복사본 (대상 의존 Execution 의 계산 결과가 담깁니다) */
+    UPROPERTY(BlueprintReadOnly, Category = "Effect")
+    FLuxEffectSpecHandle AppliedSpec;
+
+    /** 적용 성공 여부 */
+    UPROPERTY(BlueprintReadOnly, Category = "Effect")
+    bool bApplied = false;
+};
+
 /**
  * @struct FLuxEffectContext
  * @brief 이펙트가 생성되고 적용되는 순간의 모든 '상황 정보(Context)'를 담는 구조체입니다. ( 사건 경위서와 유사한 역할 )
@@ -399,6 +428,12 @@ public:
     /** 효과의 지속 시간 (초). 0 이하는 즉시 또는 무한을 의미. */
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Effect|Runtime")
     float CalculatedDuration = 0.0f;
+
+    /**
+     * 다중 대상 적용의 소스 단계(ELuxSpecPrepareStage::SourceOnly)가 이 Spec 에 대해 실행되었는지 여부입니다.
+     * 설정되어 있으면 대상 의존 Execution 은 대상 무관 부분을 다시 계산하지 않고 소스 단계 결과를 사용합니다.
+     */
+    bool bSourceStagePrepared = false;
 };
 
 inline int32 FActiveLuxEffectHandle::Counter = 0;
@@ -452,18 +487,25 @@ public:
     void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
     void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
     void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
 
     bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
     {
         return FFastArraySerializer::FastArrayDeltaSerialize<FActiveLuxEffect, FActiveLuxEffectsContainer>(Items, DeltaParms, *this);
     }
 
+    /** 핸들에 해당하는 Items 인덱스를 반환합니다. 호출자는 ActiveLuxEffectsLock 을 보유하고 있어야 합니다. */
+    int32 IndexOfHandle(const FActiveLuxEffectHandle& InHandle) const;
+
 public:
     UPROPERTY()
     TArray<FActiveLuxEffect> Items;
 
     UPROPERTY(Transient)
     TWeakObjectPtr<UActionSystemComponent> OwnerComponent;
+
+    /** 핸들 -> Items 인덱스 색인 (리플리케이션되지 않음) */
+    FLuxHandleSparseIndex HandleIndex;
 };
 #pragma endregion
 
@@ -492,6 +534,52 @@ struct FLuxModCallbackData
 };
 
 
+/**
+ * @struct FLuxAttributeAggregator
+ * @brief 단일 속성에 영향을 주는 지속 효과 Modifier 들을 적용 순서대로 모아두고, 합산 결과를 캐시하는 집계기입니다.
+ * 부동소수점 누적 순서를 기존 재계산 공식(활성 이펙트 순서 -> Modifier 순서)과 동일하게 유지하여 결과가 비트 단위로 일치합니다.
+ * 효과가 추가/제거/재중첩될 때만 이 속성의 항목들을 다시 접으며, 기본값 변경은 캐시된 합산 결과로 즉시 계산됩니다.
+ */
+struct FLuxAttributeAggregator
+{
+public:
+    /** 효과의 Modifier 하나를 목록의 끝에 추가합니다. */
+    void AddMod(const FActiveLuxEffectHandle& EffectHandle, EModifierOperation Operation, float Magnitude, int32 Stacks);
+
+    /** 지정한 효과가 추가한 모든 Modifier 를 순서를 유지한 채 제거합니다. */
+    void RemoveMods(const FActiveLuxEffectHandle& EffectHandle);
+
+    /** 지정한 효과가 추가한 Modifier 들의 스택 수를 갱신합니다. */
+    void SetStacks(const FActiveLuxEffectHandle& EffectHandle, int32 NewStacks);
+
+    /** 기본값에 집계된 Modifier 를 적용한 최종 값을 반환합니다. */
+    float Evaluate(float BaseValue);
+
+    bool IsEmpty() const { return Mods.IsEmpty(); }
+
+private:
+    /** 변경된 Modifier 목록을 다시 접어 합산 결과를 캐시합니다. */
+    void Rebuild();
+
+    struct FAggregatedMod
+    {
+        FActiveLuxEffectHandle EffectHandle;
+        EModifierOperation Operation = EModifierOperation::Add;
+        float Magnitude = 0.f;
+        int32 Stacks = 0;
+    };
+
+    /** 활성 이펙트 순서 -> Modifier 순서로 정렬된 항목들입니다. */
+    TArray<FAggregatedMod> Mods;
+
+    float CachedMultiplier = 1.0f;
+    float CachedAddition = 0.0f;
+    float CachedOverride = 0.0f;
+    bool bCachedHasOverride = false;
+    bool bDirty = false;
+};
+
+
 
 
 
@@ -22,4 +22,16 @@ public:
     void Execute(UPARAM(ref) FLuxEffectSpec& Spec) const;
 
     virtual void Execute_Implementation(FLuxEffectSpec& Spec) const;
+
+    /**
+     * 대상(TargetASC)의 상태를 읽지 않는 Execution 이면 true 를 반환합니다.
+     * true 인 Execution 은 ApplyEffectSpecToTargets 에서 대상 수와 관계없이 한 번만 실행됩니다.
+     */
+    virtual bool IsTargetIndependent() const { return false; }
+
+    /**
+     * 대상 의존 Execution 에서 대상을 읽지 않는 앞부분만 실행합니다. 기본 구현은 아무것도 하지 않습니다.
+     * ApplyEffectSpecToTargets 의 소스 단계에서 한 번 호출되며, 결과를 Spec 에 남겨 두면 대상별 Execute 에서 재사용할 수 있습니다.
+     */
+    virtual void ExecuteTargetIndependentPart(FLuxEffectSpec& Spec) const {}
 };
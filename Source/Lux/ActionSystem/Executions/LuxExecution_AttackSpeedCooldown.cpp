@@ -27,7 +27,8 @@ void ULuxExecution_AttackSpeedCooldown::Execute_Implementation(FLuxEffectSpec& S
 		return;
 	}
 
-	const FLuxActionSpec* ActionSpec = SourceASC->FindActionSpecFromHandle(ActionSpecHandle);
+	const FLuxActionSpecSnapshotPtr Snapshot = SourceASC->GetActionSpecSnapshot();
+	const FLuxActionSpecSnapshotEntry* ActionSpec = Snapshot.IsValid() ? Snapshot->Find(ActionSpecHandle) : nullptr;
 	if (!ActionSpec)
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("레벨 데이터 기반 쿨다운 실행 실패: 핸들로부터 액션 스펙을 찾을 수 없습니다."));
@@ -52,7 +53,7 @@ void ULuxExecution_AttackSpeedCooldown::Execute_Implementation(FLuxEffectSpec& S
 	const float CooldownDuration = 1.0f / AttackSpeed;
 	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Duration, CooldownDuration);
 
-	const FGameplayTag CooldownTag = ActionSpec->GetCooldownTag();
+	const FGameplayTag CooldownTag = ActionSpec->CooldownTag;
 	if (CooldownTag.IsValid())
 	{
 		Spec.DynamicGrantedTags.AddTag(CooldownTag);
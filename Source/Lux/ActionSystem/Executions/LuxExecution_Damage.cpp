@@ -19,8 +19,39 @@
 #include "LuxLogChannels.h"
 #include "LuxGameplayTags.h"
 #include "System/LuxCombatManager.h"
+#include "System/LuxTraceRecorder.h"
 
 
+void ULuxExecution_Damage::ExecuteTargetIndependentPart(FLuxEffectSpec& Spec) const
+{
+	const FLuxEffectContextHandle& ContextHandle = Spec.ContextHandle;
+	if (!ContextHandle.IsValid()) return;
+
+	UActionSystemComponent* SourceASC = ContextHandle.GetSourceASC();
+	if (!SourceASC) return;
+
+	/* ==== 입력 데이터 추출 ==== */
+	const float BasePhysicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Base, false, 0.f);
+	const float BaseMagicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Base, false, 0.f);
+	const float PhysicalDamageScale = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Scale, false, 0.f);
+	const float MagicalDamageScale = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Scale, false, 0.f);
+
+	/* ==== 시전자 능력치 가져오기 ==== */
+	const UCombatSet* SourceCombatSet = SourceASC->GetAttributeSet<UCombatSet>();
+	const float SourceAttackDamage = SourceCombatSet ? SourceCombatSet->GetAttackDamage() : 0.f;
+	const float SourceAbilityPower = SourceCombatSet ? SourceCombatSet->GetAbilityPower() : 0.f;
+
+	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Source_AttackDamage, SourceAttackDamage);
+	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Source_AbilityPower, SourceAbilityPower);
+
+	/* ==== 방어 적용 전 원시 피해량 계산 ==== */
+	const bool bHasPhysicalDamage = BasePhysicalDamage > 0.f || PhysicalDamageScale > 0.f;
+	const bool bHasMagicalDamage = BaseMagicalDamage > 0.f || MagicalDamageScale > 0.f;
+
+	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Raw, bHasPhysicalDamage ? BasePhysicalDamage + (SourceAttackDamage * PhysicalDamageScale) : 0.f);
+	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Raw, bHasMagicalDamage ? BaseMagicalDamage + (SourceAbilityPower * MagicalDamageScale) : 0.f);
+}
+
 void ULuxExecution_Damage::Execute_Implementation(FLuxEffectSpec& Spec) const
 {
 	// 컨텍스트와 액터 정보 가져오기
@@ -31,71 +62,57 @@ void ULuxExecution_Damage::Execute_Implementation(FLuxEffectSpec& Spec) const
 	UActionSystemComponent* TargetASC = ContextHandle.GetTargetASC();
 	if (!SourceASC || !TargetASC) return;
 
-	UE_LOG(LogLuxActionSystem, Log, TEXT(">> [DamageExecution] '%s'가 '%s'에게 데미지 계산을 시작합니다."), *GetNameSafe(SourceASC->GetOwner()), *GetNameSafe(TargetASC->GetOwner()));
+	// 다중 대상 적용이면 시전자 쪽 계산은 소스 단계에서 이미 끝났으므로 대상마다 다시 하지 않습니다.
+	if (!Spec.bSourceStagePrepared)
+	{
+		ExecuteTargetIndependentPart(Spec);
+	}
 
 	/* ==== 입력 데이터 추출 ==== */
 	const float BasePhysicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Base, false, 0.f);
 	const float BaseMagicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Base, false, 0.f);
 	const float PhysicalDamageScale = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Scale, false, 0.f);
 	const float MagicalDamageScale = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Scale, false, 0.f);
+	const float RawPhysicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Physical_Raw, false, 0.f);
+	const float RawMagicalDamage = Spec.GetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Raw, false, 0.f);
 
-	/* ==== 시전자와 대상의 능력치 가져오기 ==== */
+	/* ==== 대상의 능력치 가져오기 ==== */
 	const UCombatSet* SourceCombatSet = SourceASC->GetAttributeSet<UCombatSet>();
 	const UDefenseSet* TargetDefenseSet = TargetASC->GetAttributeSet<UDefenseSet>();
 
-	const float SourceAttackDamage = SourceCombatSet ? SourceCombatSet->GetAttackDamage() : 0.f;
-	const float SourceAbilityPower = SourceCombatSet ? SourceCombatSet->GetAbilityPower() : 0.f;
-
 	const float TargetArmor = TargetDefenseSet ? TargetDefenseSet->GetArmor() : 0.f;
 	const float TargetMagicResistance = TargetDefenseSet ? TargetDefenseSet->GetMagicResistance() : 0.f;
 
-	/* ==== 시전자/대상 스탯 정보를 Spec에 저장 ==== */
-	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Source_AttackDamage, SourceAttackDamage);
-	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Source_AbilityPower, SourceAbilityPower);
+	/* ==== 대상 스탯 정보를 Spec에 저장 ==== */
 	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Target_Armor, TargetArmor);
 	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Damage_Target_MagicResistance, TargetMagicResistance);
 
-	UE_LOG(LogLuxActionSystem, Log, TEXT("  - 기본(물리/마법): %.1f / %.1f | 계수(물리/마법): %.2f / %.2f"), BasePhysicalDamage, BaseMagicalDamage, PhysicalDamageScale, MagicalDamageScale);
-	UE_LOG(LogLuxActionSystem, Log, TEXT("  - 시전자(공격력/주문력): %.1f / %.1f | 대상(방어력/마법저항): %.1f / %.1f"), SourceAttackDamage, SourceAbilityPower, TargetArmor, TargetMagicResistance);
-
 	/* ==== 데미지 계산 ==== */
 	float TotalDamage = 0.f;
 	float PhysicalDamage = 0.f;
 	float MagicalDamage = 0.f;
-	float RawPhysicalDamage = 0.f;
-	float RawMagicalDamage = 0.f;
 	float PhysicalMitigation = 0.f;
 	float MagicalMitigation = 0.f;
 
 	/* ==== 물리 피해 계산 ==== */
 	if (BasePhysicalDamage > 0.f || PhysicalDamageScale > 0.f)
 	{
-		// 원시 피해량 계산
-		RawPhysicalDamage = BasePhysicalDamage + (SourceAttackDamage * PhysicalDamageScale);
-		
 		// 방어력 적용
 		PhysicalMitigation = 100.f / FMath::Max(100.f, 100.f + TargetArmor);
 		PhysicalDamage = RawPhysicalDamage * PhysicalMitigation;
-
-		UE_LOG(LogLuxActionSystem, Log, TEXT("  -> 물리 피해: Raw(%.1f) -> Mitigated(%.1f, %.1f%% 감소)"), RawPhysicalDamage, PhysicalDamage, (1.f - PhysicalMitigation) * 100.f);
 		TotalDamage += PhysicalDamage;
 	}
 
 	/* ==== 마법 피해 계산 ==== */
 	if (BaseMagicalDamage > 0.f || MagicalDamageScale > 0.f)
 	{
-		// 원시 피해량 계산
-		RawMagicalDamage = BaseMagicalDamage + (SourceAbilityPower * MagicalDamageScale);
-		
 		// 마법저항 적용
 		MagicalMitigation = 100.f / FMath::Max(100.f, 100.f + TargetMagicResistance);
 		MagicalDamage = RawMagicalDamage * MagicalMitigation;
-
-		UE_LOG(LogLuxActionSystem, Log, TEXT("  -> 마법 피해: Raw(%.1f) -> Mitigated(%.1f, %.1f%% 감소)"), RawMagicalDamage, MagicalDamage, (1.f - MagicalMitigation) * 100.f);
 		TotalDamage += MagicalDamage;
 	}
 
-	/* ==== 치명타 계산 ==== */
+	/* ==== 치명타 계산 (대상마다 따로 판정합니다) ==== */
 	bool bIsCritical = false;
 	float CriticalMultiplier = 1.0f;
 	
@@ -110,16 +127,21 @@ void ULuxExecution_Damage::Execute_Implementation(FLuxEffectSpec& Spec) const
 			bIsCritical = true;
 			CriticalMultiplier = CritDamage;
 			TotalDamage *= CriticalMultiplier;
-			
-			UE_LOG(LogLuxActionSystem, Log, TEXT("  -> 치명타 발생! 배율: %.2f, 최종 피해: %.1f"), CriticalMultiplier, TotalDamage);
 		}
 	}
 
+	// 범위 공격이면 대상마다 실행되므로, 대상별 피해 내역은 트레이스로 남깁니다.
+	if (ULuxTraceRecorder* Trace = ULuxTraceRecorder::Get(TargetASC))
+	{
+		const ULuxEffect* EffectTemplate = Spec.EffectTemplate.Get();
+		Trace->Record(ELuxTraceEvent::DamageExecution,
+			Trace->GetObjectId(SourceASC->GetAvatarActor()), Trace->GetObjectId(TargetASC->GetAvatarActor()), bIsCritical ? 1 : 0,
+			EffectTemplate ? EffectTemplate->EffectTags.First() : FGameplayTag(), FGameplayTag(), PhysicalDamage, MagicalDamage, TotalDamage);
+	}
+
 	/* ==== 최종 결과를 Spec에 저장 ==== */
 	if (TotalDamage > 0.f)
 	{
-		UE_LOG(LogLuxActionSystem, Log, TEXT("<< [DamageExecution] 최종 합산 피해량: %.1f. Spec에 기록합니다."), TotalDamage);
-
 		/* ==== 최종 적용될 데미지 정보 저장 ==== */
 		Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magnitude, -TotalDamage);
 		
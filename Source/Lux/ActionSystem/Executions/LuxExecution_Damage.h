@@ -16,4 +16,7 @@ class LUX_API ULuxExecution_Damage : public ULuxExecutionCalculation
 	
 public:
 	virtual void Execute_Implementation(FLuxEffectSpec& Spec) const override;
+
+	/** 시전자 능력치와 방어 적용 전 원시 피해량을 계산하여 Spec 에 저장합니다. */
+	virtual void ExecuteTargetIndependentPart(FLuxEffectSpec& Spec) const override;
 };
@@ -30,14 +30,15 @@ void ULuxExecution_LevelDataCooldown::Execute_Implementation(FLuxEffectSpec& Spe
 		return;
 	}
 
-	const FLuxActionSpec* ActionSpec = SourceASC->FindActionSpecFromHandle(ActionSpecHandle);
+	const FLuxActionSpecSnapshotPtr Snapshot = SourceASC->GetActionSpecSnapshot();
+	const FLuxActionSpecSnapshotEntry* ActionSpec = Snapshot.IsValid() ? Snapshot->Find(ActionSpecHandle) : nullptr;
 	if (!ActionSpec)
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("레벨 데이터 기반 쿨다운 실행 실패: 핸들로부터 액션 스펙을 찾을 수 없습니다."));
 		return;
 	}
 
-	ULuxAction* SourceAction = ActionSpec->Action;
+	const ULuxAction* SourceAction = ActionSpec->Action.Get();
 	if (!SourceAction || !SourceAction->LevelDataTable)
 	{
 		UE_LOG(LogLuxActionSystem, Error, TEXT("[%s] 소스 액션이나 레벨 데이터 테이블이 유효하지 않습니다."), *GetNameSafe(SourceAction));
@@ -65,7 +66,7 @@ void ULuxExecution_LevelDataCooldown::Execute_Implementation(FLuxEffectSpec& Spe
 	Spec.SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Duration, CooldownDuration);
 	UE_LOG(LogLuxActionSystem, Log, TEXT("레벨 데이터 기반 쿨다운 실행: 쿨다운 값 %f"), CooldownDuration);
 
-	const FGameplayTag CooldownTag = ActionSpec->GetCooldownTag();
+	const FGameplayTag CooldownTag = ActionSpec->CooldownTag;
 	if (CooldownTag.IsValid())
 	{
 		Spec.DynamicGrantedTags.AddTag(CooldownTag);
@@ -28,8 +28,10 @@ void ULuxExecution_LevelDataCost::Execute_Implementation(FLuxEffectSpec& Spec) c
 		return;
 	}
 
-	const FLuxActionSpec* SourceActionSpec = SourceASC->FindActionSpecFromHandle(SourceActionSpecHandle);
-	if (!SourceActionSpec || !SourceActionSpec->Action || !SourceActionSpec->Action->LevelDataTable)
+	const FLuxActionSpecSnapshotPtr Snapshot = SourceASC->GetActionSpecSnapshot();
+	const FLuxActionSpecSnapshotEntry* SourceActionSpec = Snapshot.IsValid() ? Snapshot->Find(SourceActionSpecHandle) : nullptr;
+	const ULuxAction* SourceAction = SourceActionSpec ? SourceActionSpec->Action.Get() : nullptr;
+	if (!SourceAction || !SourceAction->LevelDataTable)
 	{
 		UE_LOG(LogLuxActionSystem, Warning, TEXT("FromLevelData Cost Execution failed: Source Action or LevelDataTable is invalid."));
 		return;
@@ -37,7 +39,7 @@ void ULuxExecution_LevelDataCost::Execute_Implementation(FLuxEffectSpec& Spec) c
 
 	// 액션 레벨에 맞는 데이터를 가져옵니다.
 	const FName RowName = FName(*FString::FromInt(Spec.Level));
-	const FLuxActionLevelData* LevelData = SourceActionSpec->Action->LevelDataTable->FindRow<FLuxActionLevelData>(RowName, TEXT("CostExecution"));
+	const FLuxActionLevelData* LevelData = SourceAction->LevelDataTable->FindRow<FLuxActionLevelData>(RowName, TEXT("CostExecution"));
 	if (!LevelData)
 	{
 		UE_LOG(LogLuxActionSystem, Warning, TEXT("FromLevelData Cooldown Execution failed: Could not find LevelData for level %d."), (int32)Spec.Level);
@@ -16,4 +16,5 @@ class LUX_API ULuxExecution_LevelDataCost : public ULuxExecutionCalculation
 
 public:
 	virtual void Execute_Implementation(FLuxEffectSpec& Spec) const override;
+	virtual bool IsTargetIndependent() const override { return true; }
 };
@@ -77,3 +77,135 @@ bool FOwningActorInfo::operator!=(const FOwningActorInfo& Other) const
 
 	return false;
 }
+
+int32 FLuxHandleSparseIndex::Find(int32 Handle) const
+{
+	const FSparsePage* Page = Handle > 0 ? SparsePages.Find(Handle >> PageShift) : nullptr;
+	if (!Page)
+	{
+		return INDEX_NONE;
+	}
+
+	// Sparse 가 가리키는 Dense 슬롯이 다시 같은 핸들을 가리킬 때만 유효합니다.
+	const int32 ItemIndex = Page->Slots[Handle & PageMask];
+	if (!DenseHandles.IsValidIndex(ItemIndex) || DenseHandles[ItemIndex] != Handle)
+	{
+		return INDEX_NONE;
+	}
+
+	return ItemIndex;
+}
+
+void FLuxHandleSparseIndex::Add(int32 Handle, int32 ItemIndex)
+{
+	check(ItemIndex == DenseHandles.Num());
+
+	DenseHandles.Add(Handle);
+	AddSparseSlot(Handle, ItemIndex);
+	++Generation;
+}
+
+void FLuxHandleSparseIndex::RemoveAtSwap(int32 ItemIndex)
+{
+	if (!DenseHandles.IsValidIndex(ItemIndex))
+	{
+		return;
+	}
+
+	RemoveSparseSlot(DenseHandles[ItemIndex]);
+	DenseHandles.RemoveAtSwap(ItemIndex, 1, EAllowShrinking::No);
+
+	// 배열 끝에서 빈 자리로 옮겨진 항목의 인덱스를 갱신합니다.
+	if (DenseHandles.IsValidIndex(ItemIndex))
+	{
+		if (int32* MovedSlot = FindSparseSlot(DenseHandles[ItemIndex]))
+		{
+			*MovedSlot = ItemIndex;
+		}
+	}
+
+	++Generation;
+}
+
+void FLuxHandleSparseIndex::RemoveAt(int32 ItemIndex)
+{
+	if (!DenseHandles.IsValidIndex(ItemIndex))
+	{
+		return;
+	}
+
+	RemoveSparseSlot(DenseHandles[ItemIndex]);
+	DenseHandles.RemoveAt(ItemIndex, 1, EAllowShrinking::No);
+
+	// 한 칸씩 당겨진 항목들의 인덱스를 갱신합니다.
+	for (int32 Index = ItemIndex; Index < DenseHandles.Num(); ++Index)
+	{
+		if (int32* MovedSlot = FindSparseSlot(DenseHandles[Index]))
+		{
+			*MovedSlot = Index;
+		}
+	}
+
+	++Generation;
+}
+
+void FLuxHandleSparseIndex::Reset()
+{
+	SparsePages.Reset();
+	DenseHandles.Reset();
+	bDirty = false;
+	++Generation;
+}
+
+void FLuxHandleSparseIndex::ResetSparse(int32 ExpectedNum)
+{
+	// 맵의 버킷은 유지하여 재구성 때 다시 할당하지 않도록 합니다.
+	SparsePages.Reset();
+	DenseHandles.Reset(ExpectedNum);
+}
+
+int32* FLuxHandleSparseIndex::FindSparseSlot(int32 Handle)
+{
+	FSparsePage* Page = Handle > 0 ? SparsePages.Find(Handle >> PageShift) : nullptr;
+	return Page ? &Page->Slots[Handle & PageMask] : nullptr;
+}
+
+void FLuxHandleSparseIndex::AddSparseSlot(int32 Handle, int32 ItemIndex)
+{
+	if (Handle <= 0)
+	{
+		return;
+	}
+
+	// 페이지는 처음 사용될 때만 만듭니다.
+	FSparsePage& Page = SparsePages.FindOrAdd(Handle >> PageShift);
+	if (Page.Slots.Num() == 0)
+	{
+		Page.Slots.Init(INDEX_NONE, 1 << PageShift);
+	}
+
+	int32& Slot = Page.Slots[Handle & PageMask];
+	if (Slot == INDEX_NONE)
+	{
+		++Page.LiveCount;
+	}
+	Slot = ItemIndex;
+}
+
+void FLuxHandleSparseIndex::RemoveSparseSlot(int32 Handle)
+{
+	const int32 PageIndex = Handle >> PageShift;
+	FSparsePage* Page = Handle > 0 ? SparsePages.Find(PageIndex) : nullptr;
+	if (!Page || Page->Slots[Handle & PageMask] == INDEX_NONE)
+	{
+		return;
+	}
+
+	Page->Slots[Handle & PageMask] = INDEX_NONE;
+
+	// 핸들은 재사용되지 않으므로, 비어 있는 페이지는 맵에서 바로 제거합니다.
+	if (--Page->LiveCount <= 0)
+	{
+		SparsePages.Remove(PageIndex);
+	}
+}
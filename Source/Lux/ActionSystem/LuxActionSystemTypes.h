@@ -68,6 +68,90 @@ public:
 };
 
 
+/**
+ * @struct FLuxHandleSparseIndex
+ * @brief FastArray 의 Items 와 나란히 유지되는 핸들 -> 배열 인덱스 희소 집합(Sparse Set)입니다.
+ * Sparse 페이지는 핸들 값으로, Dense 배열은 Items 의 인덱스로 접근하며 두 배열이 서로를 가리킬 때만 유효한 항목으로 간주합니다.
+ * 핸들은 전역 카운터로 발급되어 재사용되지 않으므로, 제거된 핸들은 Dense 역참조 검사에서 자연스럽게 걸러집니다.
+ * 페이지는 페이지 번호를 키로 하는 맵에 살아있는 핸들이 있는 것만 보관하므로, 메모리는 전역 카운터가 아닌 이 컨테이너의 살아있는 핸들 수에 비례합니다.
+ * 리플리케이션되지 않으며 서버와 클라이언트가 각자 로컬에서 유지합니다.
+ */
+struct LUX_API FLuxHandleSparseIndex
+{
+public:
+    /** 핸들에 해당하는 Items 인덱스를 반환합니다. 없으면 INDEX_NONE 을 반환합니다. */
+    int32 Find(int32 Handle) const;
+
+    /** Items 의 끝에 추가된 항목의 핸들을 등록합니다. ItemIndex 는 반드시 Dense 배열의 끝이어야 합니다. */
+    void Add(int32 Handle, int32 ItemIndex);
+
+    /** Items.RemoveAtSwap(ItemIndex) 와 동일한 방식으로 항목을 제거하고, 끝에서 옮겨진 항목의 인덱스를 갱신합니다. */
+    void RemoveAtSwap(int32 ItemIndex);
+
+    /** Items.RemoveAt(ItemIndex) 와 동일한 방식으로 항목을 제거하고, 뒤에서 당겨진 항목들의 인덱스를 갱신합니다. (순서 유지) */
+    void RemoveAt(int32 ItemIndex);
+
+    /** Items 배열 전체로부터 색인을 다시 구성합니다. GetHandle 은 항목에서 int32 핸들 값을 반환해야 합니다. */
+    template<typename ItemType, typename ProjectionType>
+    void Rebuild(const TArray<ItemType>& Items, ProjectionType GetHandle)
+    {
+        ResetSparse(Items.Num());
+        for (int32 Index = 0; Index < Items.Num(); ++Index)
+        {
+            const int32 Handle = GetHandle(Items[Index]);
+            DenseHandles.Add(Handle);
+            AddSparseSlot(Handle, Index);
+        }
+
+        bDirty = false;
+        ++Generation;
+    }
+
+    /** 모든 항목을 제거합니다. */
+    void Reset();
+
+    /** 다음 Rebuild 가 필요하다고 표시합니다. (클라이언트 리플리케이션 도중 사용) */
+    void MarkDirty() { bDirty = true; }
+    bool IsDirty() const { return bDirty; }
+
+    /** 구조가 변경(추가/제거/재구성)될 때마다 증가하는 세대 값입니다. */
+    uint32 GetGeneration() const { return Generation; }
+
+    int32 Num() const { return DenseHandles.Num(); }
+
+private:
+    void ResetSparse(int32 ExpectedNum);
+    int32* FindSparseSlot(int32 Handle);
+    void AddSparseSlot(int32 Handle, int32 ItemIndex);
+    void RemoveSparseSlot(int32 Handle);
+
+    /**
+     * 핸들 한 페이지에 담기는 항목 수를 결정하는 시프트 값입니다. (64개)
+     * 핸들은 모든 컨테이너가 공유하는 카운터로 발급되어 한 컨테이너의 핸들은 듬성듬성하므로 페이지를 작게 둡니다.
+     */
+    static constexpr int32 PageShift = 6;
+    static constexpr int32 PageMask = (1 << PageShift) - 1;
+
+    struct FSparsePage
+    {
+        /** 페이지 내 오프셋 -> Items 인덱스 */
+        TArray<int32, TFixedAllocator<1 << PageShift>> Slots;
+
+        /** 이 페이지에 등록된 핸들 수. 0이 되면 페이지를 제거합니다. */
+        int32 LiveCount = 0;
+    };
+
+    /** 페이지 번호(핸들 >> PageShift) -> 페이지. 살아있는 핸들이 있는 페이지만 보관합니다. */
+    TMap<int32, FSparsePage> SparsePages;
+
+    /** Items 인덱스 -> 핸들 값. Items 와 동일한 순서를 유지합니다. */
+    TArray<int32> DenseHandles;
+
+    uint32 Generation = 0;
+    bool bDirty = false;
+};
+
+
 template<>
 struct TStructOpsTypeTraits<FOwningActorInfo> : public TStructOpsTypeTraitsBase2<FOwningActorInfo>
 {
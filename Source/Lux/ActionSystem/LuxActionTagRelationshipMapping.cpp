@@ -5,51 +5,136 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LuxActionTagRelationshipMapping)
 
-void ULuxActionTagRelationshipMapping::GetBlockedActivationTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToBlock) const
+void ULuxActionTagRelationshipMapping::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// PostLoad 를 거치지 않고 생성된 에셋도 조회 테이블을 갖도록 여기서 먼저 컴파일합니다.
+	CompileRelationships();
+}
+
+void ULuxActionTagRelationshipMapping::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileRelationships();
+}
+
+#if WITH_EDITOR
+void ULuxActionTagRelationshipMapping::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// 관계가 편집되면 컴파일된 테이블과 메모이즈 캐시를 다시 만듭니다.
+	CompileRelationships();
+}
+#endif
+
+void ULuxActionTagRelationshipMapping::CompileRelationships()
 {
+	FRWScopeLock WriteLock(CacheLock, SLT_Write);
+
+	CompiledRelationships.Reset();
+	MemoizedResults.Reset();
+
 	for (const FActionTagRelationship& Tags : ActionTagRelationships)
 	{
-		if (ActionTags.HasTag(Tags.ActionTag))
+		if (!Tags.ActionTag.IsValid())
 		{
-			OutTagsToBlock.AppendTags(Tags.ActivationBlockedTags);
+			continue;
 		}
+
+		FActionTagRelationshipResult& Compiled = CompiledRelationships.FindOrAdd(Tags.ActionTag);
+		Compiled.ActionTagsToCancel.AppendTags(Tags.ActionTagsToCancel);
+		Compiled.ActivationRequiredTags.AppendTags(Tags.ActivationRequiredTags);
+		Compiled.ActivationBlockedTags.AppendTags(Tags.ActivationBlockedTags);
 	}
 }
 
-void ULuxActionTagRelationshipMapping::GetRequiredActivationTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToRequire) const
+uint32 ULuxActionTagRelationshipMapping::GetTagSetHash(const FGameplayTagContainer& ActionTags)
 {
-	for (const FActionTagRelationship& Tags : ActionTagRelationships)
+	// FGameplayTagContainer 의 비교는 순서와 무관하므로 해시도 순서와 무관하게 합산합니다.
+	uint32 Hash = ActionTags.Num();
+	for (const FGameplayTag& Tag : ActionTags)
 	{
-		if (ActionTags.HasTag(Tags.ActionTag))
-		{
-			OutTagsToRequire.AppendTags(Tags.ActivationRequiredTags);
-		}
+		Hash += GetTypeHash(Tag);
 	}
+	return Hash;
 }
 
-void ULuxActionTagRelationshipMapping::GetCancelledByTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToCancel) const
+const FActionTagRelationshipResult& ULuxActionTagRelationshipMapping::GetRelationshipsForTags(const FGameplayTagContainer& ActionTags) const
 {
-	for (const FActionTagRelationship& Tags : ActionTagRelationships)
+	const uint32 Hash = GetTagSetHash(ActionTags);
+
 	{
-		if (ActionTags.HasTag(Tags.ActionTag))
+		FRWScopeLock ReadLock(CacheLock, SLT_ReadOnly);
+		if (const TArray<TUniquePtr<FMemoizedResult>>* Bucket = MemoizedResults.Find(Hash))
 		{
-			OutTagsToCancel.AppendTags(Tags.ActionTagsToCancel);
+			for (const TUniquePtr<FMemoizedResult>& Entry : *Bucket)
+			{
+				if (Entry->ActionTags == ActionTags)
+				{
+					return Entry->Result;
+				}
+			}
 		}
 	}
-}
 
-bool ULuxActionTagRelationshipMapping::IsActionCancelledByTag(const FGameplayTagContainer& ActionTags, const FGameplayTag& ActionTag) const
-{
-	// Simple iteration for now
-	for (int32 i = 0; i < ActionTagRelationships.Num(); i++)
+	FRWScopeLock WriteLock(CacheLock, SLT_Write);
+
+	// 락을 바꾸는 사이 다른 스레드가 같은 조합을 추가했을 수 있으므로 다시 확인합니다.
+	TArray<TUniquePtr<FMemoizedResult>>& Bucket = MemoizedResults.FindOrAdd(Hash);
+	for (const TUniquePtr<FMemoizedResult>& Entry : Bucket)
 	{
-		const FActionTagRelationship& Tags = ActionTagRelationships[i];
+		if (Entry->ActionTags == ActionTags)
+		{
+			return Entry->Result;
+		}
+	}
+
+	// 결과는 TUniquePtr 로 보관하므로 맵이 재할당되어도 반환한 참조가 유지됩니다.
+	TUniquePtr<FMemoizedResult>& NewEntry = Bucket.Add_GetRef(MakeUnique<FMemoizedResult>());
+	NewEntry->ActionTags = ActionTags;
 
-		if (Tags.ActionTag == ActionTag && Tags.ActionTagsToCancel.HasAny(ActionTags))
+	// ActionTags.HasTag() 와 같은 계층 일치를 위해 각 태그의 부모까지 올라가며 조회합니다.
+	for (const FGameplayTag& ActionTag : ActionTags)
+	{
+		for (FGameplayTag Current = ActionTag; Current.IsValid(); Current = Current.RequestDirectParent())
 		{
-			return true;
+			if (const FActionTagRelationshipResult* Compiled = CompiledRelationships.Find(Current))
+			{
+				NewEntry->Result.ActionTagsToCancel.AppendTags(Compiled->ActionTagsToCancel);
+				NewEntry->Result.ActivationRequiredTags.AppendTags(Compiled->ActivationRequiredTags);
+				NewEntry->Result.ActivationBlockedTags.AppendTags(Compiled->ActivationBlockedTags);
+			}
 		}
 	}
 
-	return false;
-}
\ No newline at end of file
+	// 병합 결과는 조합별로 한 번만 만들어지므로 질의도 여기서 한 번만 컴파일합니다.
+	NewEntry->Result.ActivationRequiredQuery = FLuxCompiledTagQuery::Compile(NewEntry->Result.ActivationRequiredTags, FGameplayTagContainer::EmptyContainer, FGameplayTagContainer::EmptyContainer);
+	NewEntry->Result.ActivationBlockedQuery = FLuxCompiledTagQuery::Compile(FGameplayTagContainer::EmptyContainer, FGameplayTagContainer::EmptyContainer, NewEntry->Result.ActivationBlockedTags);
+
+	return NewEntry->Result;
+}
+
+void ULuxActionTagRelationshipMapping::GetBlockedActivationTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToBlock) const
+{
+	OutTagsToBlock.AppendTags(GetRelationshipsForTags(ActionTags).ActivationBlockedTags);
+}
+
+void ULuxActionTagRelationshipMapping::GetRequiredActivationTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToRequire) const
+{
+	OutTagsToRequire.AppendTags(GetRelationshipsForTags(ActionTags).ActivationRequiredTags);
+}
+
+void ULuxActionTagRelationshipMapping::GetCancelledByTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToCancel) const
+{
+	OutTagsToCancel.AppendTags(GetRelationshipsForTags(ActionTags).ActionTagsToCancel);
+}
+
+bool ULuxActionTagRelationshipMapping::IsActionCancelledByTag(const FGameplayTagContainer& ActionTags, const FGameplayTag& ActionTag) const
+{
+	FRWScopeLock ReadLock(CacheLock, SLT_ReadOnly);
+	const FActionTagRelationshipResult* Compiled = CompiledRelationships.Find(ActionTag);
+	return Compiled && Compiled->ActionTagsToCancel.HasAny(ActionTags);
+}
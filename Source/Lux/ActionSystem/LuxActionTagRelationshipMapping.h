@@ -4,6 +4,7 @@
 
 #include "Engine/DataAsset.h"
 #include "GameplayTagContainer.h"
+#include "System/GameplayTagStack.h"
 #include "LuxActionTagRelationshipMapping.generated.h"
 
 /** 특정 어빌리티 태그와 그 외 태그들의 관계를 정의하는 구조체 */
@@ -30,6 +31,19 @@ struct FActionTagRelationship
 };
 
 
+/** 하나의 ActionTags 조합에 대해 모든 관계를 병합한 결과입니다. (런타임 캐시) */
+struct FActionTagRelationshipResult
+{
+	FGameplayTagContainer ActionTagsToCancel;
+	FGameplayTagContainer ActivationRequiredTags;
+	FGameplayTagContainer ActivationBlockedTags;
+
+	/** 위 필수/차단 태그를 미리 컴파일한 질의입니다. (RequireAll / RequireNone) */
+	FLuxCompiledTagQuery ActivationRequiredQuery;
+	FLuxCompiledTagQuery ActivationBlockedQuery;
+};
+
+
 /** 어빌리티 태그가 다른 어빌리티를 차단/취소하는 규칙을 정의하는 데이터 에셋 */
 UCLASS()
 class ULuxActionTagRelationshipMapping : public UDataAsset
@@ -42,6 +56,17 @@ private:
 	TArray<FActionTagRelationship> ActionTagRelationships;
 
 public:
+	//~UObject interface
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
+	/** 주어진 액션 태그 조합에 대해 병합된 취소/필수/차단 태그를 반환합니다. (조합별로 메모이즈됩니다.) */
+	const FActionTagRelationshipResult& GetRelationshipsForTags(const FGameplayTagContainer& ActionTags) const;
+
 	/** 주어진 액션 태그에 의해 활성화가 '차단'되는 태그들을 가져옵니다. */
 	void GetBlockedActivationTags(const FGameplayTagContainer& ActionTags, FGameplayTagContainer& OutTagsToBlock) const;
 
@@ -53,4 +78,25 @@ public:
 
 	/** 특정 액션 태그에 의해 어빌리티 태그들이 취소되는지 여부를 반환합니다 */
 	bool IsActionCancelledByTag(const FGameplayTagContainer& ActionTags, const FGameplayTag& ActionTag) const;
+
+private:
+	/** ActionTagRelationships 를 태그별 조회 테이블로 컴파일하고 메모이즈 캐시를 비웁니다. */
+	void CompileRelationships();
+
+	/** 순서와 무관한 태그 조합 해시입니다. */
+	static uint32 GetTagSetHash(const FGameplayTagContainer& ActionTags);
+
+	/** 같은 ActionTag 를 가진 관계들을 병합한 태그별 조회 테이블 */
+	TMap<FGameplayTag, FActionTagRelationshipResult> CompiledRelationships;
+
+	/** ActionTags 조합별 병합 결과 캐시. 해시 충돌은 컨테이너 비교로 구분합니다. */
+	struct FMemoizedResult
+	{
+		FGameplayTagContainer ActionTags;
+		FActionTagRelationshipResult Result;
+	};
+	mutable TMap<uint32, TArray<TUniquePtr<FMemoizedResult>>> MemoizedResults;
+
+	/** 캐시 접근을 보호하는 락 */
+	mutable FRWLock CacheLock;
 };
\ No newline at end of file
@@ -20,7 +20,8 @@ ULuxActionTask_TraceAndBuildPath* ULuxActionTask_TraceAndBuildPath::TraceAndBuil
 	float InTraceDistance,
 	float InStepSize,
 	float InHeightThreshold,
-	float InMaxHeightDifference)
+	float InMaxHeightDifference,
+	float InPathSimplifyTolerance)
 {
 	if (!InOwningAction)
 	{
@@ -44,6 +45,7 @@ ULuxActionTask_TraceAndBuildPath* ULuxActionTask_TraceAndBuildPath::TraceAndBuil
 	NewTask->StepSize = InStepSize;
 	NewTask->HeightThreshold = InHeightThreshold;
 	NewTask->MaxHeightDifference = InMaxHeightDifference;
+	NewTask->PathSimplifyTolerance = InPathSimplifyTolerance;
 	NewTask->Activate();
 
 	return NewTask;
@@ -57,6 +59,7 @@ void ULuxActionTask_TraceAndBuildPath::InitializeFromStruct(const FInstancedStru
 		StepSize = Params->StepSize.GetValue(OwningAction.Get());
 		HeightThreshold = Params->HeightThreshold.GetValue(OwningAction.Get());
 		MaxHeightDifference = Params->MaxHeightDifference.GetValue(OwningAction.Get());
+		PathSimplifyTolerance = Params->PathSimplifyTolerance;
 	}
 }
 
@@ -105,6 +108,9 @@ void ULuxActionTask_TraceAndBuildPath::OnActivated()
 	FPayload_PathData PathDataPayload;
 	PathDataPayload.PathPoints = PathPoints;
 
+	// 로컬에서도 단순화된 경로를 사용해야 서버/다른 클라이언트와 같은 경로가 됩니다.
+	PathDataPayload.Simplify(PathSimplifyTolerance);
+
 	FContextPayload ContextPayload;
 	ContextPayload.SetData<FPayload_PathData>(LuxPayloadKeys::PathData, PathDataPayload);
 
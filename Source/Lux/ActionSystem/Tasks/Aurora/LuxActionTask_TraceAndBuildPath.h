@@ -33,6 +33,10 @@ public:
     /** 평지/오르막/내리막을 구분하는 기준 높이 차이입니다. */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pathfinding")
     FDynamicFloat MaxHeightDifference;
+
+    /** 전송 전 경로 단순화 허용 오차(cm)입니다. 0 이면 StepSize 마다 생성된 점을 모두 보냅니다. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Pathfinding", meta = (ClampMin = "0.0"))
+    float PathSimplifyTolerance = 2.f;
 };
 
 
@@ -67,6 +71,7 @@ public:
      * @param InStepSize 탐색을 진행할 간격(단계)의 크기입니다.
      * @param InHeightThreshold 경로 생성을 중단할 최대 높이 차이입니다.
      * @param InMaxHeightDifference 평지/오르막/내리막을 구분하는 기준 높이 차이입니다.
+     * @param InPathSimplifyTolerance 전송 전 경로 단순화 허용 오차(cm)입니다.
      */
     UFUNCTION(BlueprintCallable, Category = "LuxActionSystem|Task", meta = (DisplayName = "Trace And Build Path"))
     static ULuxActionTask_TraceAndBuildPath* TraceAndBuildPath(
@@ -74,7 +79,8 @@ public:
         float InTraceDistance = 1200.f,
         float InStepSize = 50.f,
         float InHeightThreshold = 600.f,
-        float InMaxHeightDifference = 100.f
+        float InMaxHeightDifference = 100.f,
+        float InPathSimplifyTolerance = 2.f
     );
 
 protected:
@@ -102,4 +108,7 @@ private:
 
     UPROPERTY()
     float MaxHeightDifference;
+
+    UPROPERTY()
+    float PathSimplifyTolerance = 2.f;
 };
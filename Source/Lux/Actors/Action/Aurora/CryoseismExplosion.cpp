@@ -236,6 +236,23 @@ void ACryoseismExplosion::HandleExplosion()
 {
 	if (!SourceASC.IsValid()) return;
 
+	ULuxCombatManager* CombatManager = GetWorld()->GetSubsystem<ULuxCombatManager>();
+	if (!CombatManager)
+	{
+		UE_LOG(LogLuxActionSystem, Error, TEXT("CryoseismExplosion: Failed to get CombatManager"));
+		return;
+	}
+
+	TSubclassOf<ULuxEffect> DamageEffectClass = CombatManager->GetDefaultDamageEffect();
+	if (!DamageEffectClass)
+	{
+		UE_LOG(LogLuxActionSystem, Error, TEXT("CryoseismExplosion: Failed to get DamageEffectClass"));
+		return;
+	}
+
+	// 이번 폭발에 맞은 대상들을 먼저 모읍니다.
+	TArray<AActor*> HitTargets;
+	TArray<UActionSystemComponent*> HitTargetASCs;
 	for (AActor* Target : TargetsForNextExplosion)
 	{
 		if (AlreadyAffectedTargets.Contains(Target)) 
@@ -247,22 +264,14 @@ void ACryoseismExplosion::HandleExplosion()
 		UActionSystemComponent* TargetASC = TargetASI->GetActionSystemComponent();
 		if (!TargetASC) continue;
 
-		ULuxCombatManager* CombatManager = GetWorld()->GetSubsystem<ULuxCombatManager>();
-		if (!CombatManager)
-		{
-			UE_LOG(LogLuxActionSystem, Error, TEXT("CryoseismExplosion: Failed to get CombatManager"));
-			return;
-		}
-
-		TSubclassOf<ULuxEffect> DamageEffectClass = CombatManager->GetDefaultDamageEffect();
-		if (!DamageEffectClass)
-		{
-			UE_LOG(LogLuxActionSystem, Error, TEXT("CryoseismExplosion: Failed to get DamageEffectClass"));
-			return;
-		}
+		HitTargets.Add(Target);
+		HitTargetASCs.Add(TargetASC);
+	}
 
+	// 하나의 피해 Spec 을 모든 대상에게 적용하여 시전자 쪽 계산을 한 번만 수행합니다.
+	if (HitTargetASCs.Num() > 0)
+	{
 		FLuxEffectContextHandle Context = SourceASC->MakeEffectContext();
-		Context.SetTargetASC(TargetASC);
 		Context.SetSourceAction(ActionSpecHandle);
 
 		FLuxEffectSpecHandle DamageSpec = SourceASC->MakeOutgoingSpec(DamageEffectClass, Level, Context);
@@ -271,9 +280,16 @@ void ACryoseismExplosion::HandleExplosion()
 			DamageSpec.Get()->SetByCallerMagnitude(LuxGameplayTags::Effect_SetByCaller_Magical_Base, ExplosionDamage);
 		}
 
-		// 데미지 & 얼어붙음 효과 적용
+		CombatManager->ApplyDamageToTargets(SourceASC.Get(), HitTargetASCs, DamageSpec);
+	}
+
+	for (int32 TargetIndex = 0; TargetIndex < HitTargets.Num(); ++TargetIndex)
+	{
+		AActor* Target = HitTargets[TargetIndex];
+		UActionSystemComponent* TargetASC = HitTargetASCs[TargetIndex];
+
+		// 얼어붙음 효과 적용
 		const float DurationToApply = bIsInitialExplosion ? StunDuration : ChainStunDuration;
-		CombatManager->ApplyDamage(SourceASC.Get(), TargetASC, DamageSpec);
 		CombatManager->ApplyCrowdControl(
 			SourceASC.Get(),
 			TargetASC,
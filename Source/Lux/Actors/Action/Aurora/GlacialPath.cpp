@@ -83,7 +83,7 @@ void AGlacialPath::Initialize(ULuxAction* Action, bool bAutoStart)
 		return;
 	}
 
-	const FPayload_PathData* PathData = Action->ActionPayload->GetData<FPayload_PathData>(FName("PathData"));
+	const FPayload_PathData* PathData = Action->ActionPayload->GetData<FPayload_PathData>(LuxPayloadKeys::PathData);
 	if (!PathData || PathData->PathPoints.Num() < 2)
 	{
 		UE_LOG(LogLux, Error, TEXT("GlacialPath: Initialize 실패 - ActionPayload에서 유효한 경로 데이터를 찾을 수 없습니다."));
@@ -93,12 +93,13 @@ void AGlacialPath::Initialize(ULuxAction* Action, bool bAutoStart)
 	// 구체적인 초기화 로직
 	if(const FAuroraActionLevelData_GlacialCharge* Data = LevelData->ActionSpecificData.GetPtr<FAuroraActionLevelData_GlacialCharge>())
 	{
-		Multicast_BuildSpline(*Data, PathData->PathPoints, bAutoStart);
+		Multicast_BuildSpline(*Data, *PathData, bAutoStart);
 	}
 }
 
-void AGlacialPath::Multicast_BuildSpline_Implementation(const FAuroraActionLevelData_GlacialCharge& Data, const TArray<FVector>& PathPoints, bool bAutoStart)
+void AGlacialPath::Multicast_BuildSpline_Implementation(const FAuroraActionLevelData_GlacialCharge& Data, const FPayload_PathData& PathData, bool bAutoStart)
 {
+	const TArray<FVector>& PathPoints = PathData.PathPoints;
 	if (PathPoints.Num() < 2)
 	{
 		return;
@@ -118,11 +119,13 @@ void AGlacialPath::Multicast_BuildSpline_Implementation(const FAuroraActionLevel
 	}
 
 	// 스플라인 컴포넌트에 경로 지점을 설정합니다.
+	// 경로는 폴리라인 기준의 허용 오차로 단순화되었으므로, 곡선 보간으로 점 사이가 부풀지 않도록 선형으로 잇습니다.
 	SplineComponent->ClearSplinePoints();
-	for (const FVector& Point : PathPoints)
+	for (int32 i = 0; i < PathPoints.Num(); ++i)
 	{
-		SplineComponent->AddSplinePoint(Point, ESplineCoordinateSpace::World, false);
-		//DrawDebugSphere(GetWorld(), Point, 10.0f, 12, FColor::Green, false, 5.0f);
+		SplineComponent->AddSplinePoint(PathPoints[i], ESplineCoordinateSpace::World, false);
+		SplineComponent->SetSplinePointType(i, ESplinePointType::Linear, false);
+		//DrawDebugSphere(GetWorld(), PathPoints[i], 10.0f, 12, FColor::Green, false, 5.0f);
 	}
 	SplineComponent->UpdateSpline();
 
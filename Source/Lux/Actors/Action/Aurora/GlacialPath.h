@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Actors/ActorInitData.h"
 #include "Actors/LuxBaseActionActor.h"
+#include "ActionSystem/Actions/LuxPayload.h"
 #include "GlacialPath.generated.h"
 
 class USplineComponent;
@@ -33,9 +34,12 @@ protected:
 	virtual void Tick(float DeltaTime) override;
 	// ~ End of AActor interface
 
-	/** 모든 클라이언트에서 실행되어 스플라인을 생성하고 메시 생성을 시작하는 RPC 함수입니다. */
+	/**
+	 * 모든 클라이언트에서 실행되어 스플라인을 생성하고 메시 생성을 시작하는 RPC 함수입니다.
+	 * 경로는 FPayload_PathData 의 경로 코덱(델타 부호화)으로 전송됩니다.
+	 */
 	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_BuildSpline(const FAuroraActionLevelData_GlacialCharge& Data, const TArray<FVector>& PathPoints, bool bAutoStart);
+	void Multicast_BuildSpline(const FAuroraActionLevelData_GlacialCharge& Data, const FPayload_PathData& PathData, bool bAutoStart);
 
 	/** 타이머에 의해 주기적으로 호출되어 스플라인 메시를 하나씩 생성합니다. */
 	UFUNCTION()
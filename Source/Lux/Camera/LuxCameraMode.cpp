@@ -34,14 +34,8 @@ bool ULuxCameraMode::CanActivate() const
         return false;
     }
 
-    // 차단 태그가 하나라도 있는지 확인합니다.
-    if (ASC->HasAny(ActivationBlockedTags))
-    {
-        return false;
-    }
-
-    // 필요한 태그를 모두 가지고 있는지 확인합니다.
-    if (!ASC->HasAll(ActivationRequiredTags))
+    // 차단 태그가 하나도 없고, 필요한 태그를 모두 가지고 있는지 한 번의 질의로 확인합니다.
+    if (!ASC->MatchesTagQuery(ActivationTagQuery.GetOrCompile(ActivationRequiredTags, FGameplayTagContainer::EmptyContainer, ActivationBlockedTags)))
     {
         return false;
     }
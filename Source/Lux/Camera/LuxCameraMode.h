@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "GameplayTagContainer.h"
+#include "System/GameplayTagStack.h"
 #include "LuxCameraMode.generated.h"
 
 class UTargetFilter;
@@ -167,4 +168,8 @@ protected:
     FLuxCameraModeView View;
 
     float CurrentDynamicFOV;
+
+private:
+    /** 활성화 조건(Required = RequireAll, Blocked = RequireNone)을 컴파일한 질의 캐시입니다. */
+    FLuxCompiledTagQuery ActivationTagQuery;
 };
\ No newline at end of file
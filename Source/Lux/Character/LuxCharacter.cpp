@@ -119,7 +119,7 @@ void ALuxCharacter::OnActionSystemInitialized()
 	if (MovementSet)
 	{
 		MovementSet->OnMoveSpeedChanged.AddDynamic(this, &ALuxCharacter::OnMoveSpeedChanged);
-		GetCharacterMovement()->MaxWalkSpeed = MovementSet->GetMoveSpeed();
+		OnMoveSpeedChanged(0.0f, MovementSet->GetMoveSpeed());
 	}
 }
 
@@ -256,7 +256,11 @@ void ALuxCharacter::OnDeathFinished(AActor* OwningActor)
 
 void ALuxCharacter::OnMoveSpeedChanged(float OldValue, float NewValue)
 {
-	if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
+	if (ULuxCharacterMovementComponent* LuxMoveComp = Cast<ULuxCharacterMovementComponent>(GetCharacterMovement()))
+	{
+		LuxMoveComp->SetMoveSpeed(NewValue);
+	}
+	else if (UCharacterMovementComponent* MoveComp = GetCharacterMovement())
 	{
 		MoveComp->MaxWalkSpeed = NewValue;
 	}
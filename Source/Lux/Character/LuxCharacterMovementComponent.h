@@ -6,6 +6,13 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "LuxCharacterMovementComponent.generated.h"
 
+/** ASC 가 태그 변경 시점에 밀어 넣는 이동 제약 상태입니다. */
+struct FLuxMovementModifierState
+{
+	/** State.Block.Movement (또는 그 자식 태그) 보유 여부 */
+	bool bMovementBlocked = false;
+};
+
 /**
  * 
  */
@@ -17,4 +24,14 @@ class LUX_API ULuxCharacterMovementComponent : public UCharacterMovementComponen
 public:
 	/** 캐릭터의 상태(예: 태그)를 모두 고려하여 최종 최대 속도를 반환합니다. */
 	virtual float GetMaxSpeed() const override;
+
+	/** 이동 차단 여부를 갱신합니다. (ASC 가 태그 변경 시 호출) */
+	void SetMovementBlocked(bool bBlocked);
+
+	/** 이동 속도 속성 값을 MaxWalkSpeed 에 반영합니다. */
+	void SetMoveSpeed(float NewMoveSpeed);
+
+private:
+	/** GetMaxSpeed 는 이동 서브스텝과 보정 재실행마다 호출되므로, 캐스팅이나 태그 조회 없이 이 값만 읽습니다. */
+	FLuxMovementModifierState ModifierState;
 };
@@ -291,6 +291,12 @@ void ULuxHeroComponent::SetupInputMappings(const APawn* Pawn, UEnhancedInputLoca
 	// be triggered directly by these input actions Triggered events. 
 	TArray<uint32> BindHandles;
 	LuxIC->BindAbilityActions(InputConfig, this, &ThisClass::Input_ActionInputTagPressed, &ThisClass::Input_ActionInputTagReleased, /*out*/ BindHandles);
+
+	// 입력 태그 → 입력 액션 → 액션 Spec 핸들 라우팅 테이블을 구성합니다.
+	if (UActionSystemComponent* LuxASC = PawnExtComp->GetActionSystemComponent())
+	{
+		LuxASC->InitializeInputRouting(InputConfig);
+	}
 	
 	LuxIC->BindNativeAction(InputConfig, LuxGameplayTags::InputTag_Move, ETriggerEvent::Triggered, this, &ThisClass::Input_Move, /*bLogIfNotFound=*/ false);
 	LuxIC->BindNativeAction(InputConfig, LuxGameplayTags::InputTag_Jump, ETriggerEvent::Started, this, &ThisClass::Input_Jump, /*bLogIfNotFound=*/ false);
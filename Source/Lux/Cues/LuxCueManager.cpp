@@ -4,6 +4,7 @@
 #include "Cues/LuxCueManager.h"
 #include "System/LuxAssetManager.h"
 #include "System/LuxGameData.h"
+#include "System/LuxTraceRecorder.h"
 #include "LuxLogChannels.h"
 #include "Engine/DataTable.h"
 
@@ -177,10 +178,8 @@ void ULuxCueManager::HandleCue(AActor* Target, FGameplayTag CueTag, const FLuxCu
 {
 	if (!Target || !CueTag.IsValid()) return;
 
-	const FString ContextString = GetClientServerContextString(Target);
-	UE_LOG(LogLux, Log, TEXT("[%s][CueManager::HandleCue] Received request to handle cue. CueTag: %s, Target: %s"), *ContextString, *CueTag.ToString(), *GetNameSafe(Target));
-
 	ALuxCueNotify* CueToExecute = nullptr;
+	bool bFromPool = false;
 
 	// 풀에서 사용 가능한 큐를 가져옵니다.
 	if (FLuxCueNotifyPool* Pool = CuePools.Find(CueTag))
@@ -190,6 +189,7 @@ void ULuxCueManager::HandleCue(AActor* Target, FGameplayTag CueTag, const FLuxCu
 			CueToExecute = Pool->Items.Pop();
 			if (CueToExecute)
 			{
+				bFromPool = true;
 				CueToExecute->SetActorTransform(FTransform(Context.Rotation, Context.Location, FVector::OneVector));
 			}
 		}
@@ -198,18 +198,30 @@ void ULuxCueManager::HandleCue(AActor* Target, FGameplayTag CueTag, const FLuxCu
 	// 풀에 큐가 없다면 새로 생성합니다.
 	if (!CueToExecute)
 	{
-		UE_LOG(LogLux, Log, TEXT("[%s][CueManager] No available cue in pool for tag '%s'. Attempting to spawn a new instance."), *ContextString, *CueTag.ToString());
 		const FTransform SpawnTransform(Context.Rotation, Context.Location, FVector::OneVector);
 		CueToExecute = SpawnNewCue(CueTag, SpawnTransform);
 	}
 
+	// 풀 재사용 여부는 큐마다 달라지므로 성공/실패 모두 대상과 시전자를 함께 트레이스에 남깁니다.
+	ULuxTraceRecorder* Trace = ULuxTraceRecorder::Get(Target);
+	const int32 TargetId = Trace ? Trace->GetObjectId(Target) : INDEX_NONE;
+	const int32 InstigatorId = Trace ? Trace->GetObjectId(Context.Instigator.Get()) : INDEX_NONE;
+
 	if (!CueToExecute)
 	{
-		UE_LOG(LogLux, Error, TEXT("[%s][CueManager] FAILED TO CREATE a new cue instance for tag '%s'. The cue will not be executed."), *ContextString, *CueTag.ToString());
+		if (Trace)
+		{
+			Trace->Record(ELuxTraceEvent::HandleCueFailed, TargetId, InstigatorId, 0, CueTag);
+		}
+
+		UE_LOG(LogLux, Error, TEXT("[%s][CueManager] FAILED TO CREATE a new cue instance for tag '%s'. The cue will not be executed."), *GetClientServerContextString(Target), *CueTag.ToString());
 		return;
 	}
 
-	UE_LOG(LogLuxActionSystem, Log, TEXT("[%s][CueManager] Cue '%s' is ready. Adding to active list and executing."), *ContextString, *GetNameSafe(CueToExecute));
+	if (Trace)
+	{
+		Trace->Record(ELuxTraceEvent::HandleCue, TargetId, InstigatorId, bFromPool ? 1 : 0, CueTag);
+	}
 
 	// 큐를 활성화 목록에 추가하고 실행합니다.
 	FActiveCueNotifyMap& TargetCues = ActiveCues.FindOrAdd(Target);
@@ -9,15 +9,53 @@ ULuxInputConfig::ULuxInputConfig(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+void ULuxInputConfig::PostLoad()
+{
+	Super::PostLoad();
 
-const UInputAction* ULuxInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+	BuildInputActionMaps();
+}
+
+#if WITH_EDITOR
+void ULuxInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildInputActionMaps();
+}
+#endif
+
+void ULuxInputConfig::BuildInputActionMaps() const
 {
-	for (const FLuxInputAction& Action : NativeInputActions)
+	auto BuildMap = [](const TArray<FLuxInputAction>& Actions, TMap<FGameplayTag, const UInputAction*>& OutMap)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
+		OutMap.Reset();
+		for (const FLuxInputAction& Action : Actions)
 		{
-			return Action.InputAction;
+			// 기존 선형 탐색과 동일하게 먼저 정의된 항목이 우선합니다.
+			if (Action.InputAction && Action.InputTag.IsValid() && !OutMap.Contains(Action.InputTag))
+			{
+				OutMap.Add(Action.InputTag, Action.InputAction);
+			}
 		}
+	};
+
+	BuildMap(NativeInputActions, NativeInputActionMap);
+	BuildMap(AbilityInputActions, AbilityInputActionMap);
+	bInputActionMapsBuilt = true;
+}
+
+
+const UInputAction* ULuxInputConfig::FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
+{
+	if (!bInputActionMapsBuilt)
+	{
+		BuildInputActionMaps();
+	}
+
+	if (const UInputAction* const* Found = NativeInputActionMap.Find(InputTag))
+	{
+		return *Found;
 	}
 
 	if (bLogNotFound)
@@ -30,12 +68,14 @@ const UInputAction* ULuxInputConfig::FindNativeInputActionForTag(const FGameplay
 
 const UInputAction* ULuxInputConfig::FindAbilityInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound) const
 {
-	for (const FLuxInputAction& Action : AbilityInputActions)
+	if (!bInputActionMapsBuilt)
 	{
-		if (Action.InputAction && (Action.InputTag == InputTag))
-		{
-			return Action.InputAction;
-		}
+		BuildInputActionMaps();
+	}
+
+	if (const UInputAction* const* Found = AbilityInputActionMap.Find(InputTag))
+	{
+		return *Found;
 	}
 
 	if (bLogNotFound)
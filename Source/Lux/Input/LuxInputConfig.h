@@ -38,6 +38,13 @@ class LUX_API ULuxInputConfig : public UDataAsset
 public:
 	ULuxInputConfig(const FObjectInitializer& ObjectInitializer);
 
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
 	// 주어진 태그에 해당하는 네이티브 입력 액션을 찾아 반환합니다. (못 찾으면 로그 출력)
 	UFUNCTION(BlueprintCallable, Category = "Lux|Pawn")
 	const UInputAction* FindNativeInputActionForTag(const FGameplayTag& InputTag, bool bLogNotFound = true) const;
@@ -54,4 +61,14 @@ public:
 	// 디자이너가 정의하는 어빌리티 입력 액션 목록입니다. 이 입력 액션들은 게임플레이 태그에 바인딩되며, 매칭되는 입력 태그를 가진 어빌리티가 자동적으로 바인딩됩니다.
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Meta = (TitleProperty = "InputAction"))
 	TArray<FLuxInputAction> AbilityInputActions;
+
+private:
+	/** 입력 액션 배열을 태그 → 입력 액션 해시 맵으로 구성합니다. (같은 태그가 여러 번 있으면 첫 항목을 사용) */
+	void BuildInputActionMaps() const;
+
+	/** 태그로 입력 액션을 바로 찾기 위한 비직렬화 캐시입니다. */
+	mutable TMap<FGameplayTag, const UInputAction*> NativeInputActionMap;
+	mutable TMap<FGameplayTag, const UInputAction*> AbilityInputActionMap;
+
+	mutable bool bInputActionMapsBuilt = false;
 };
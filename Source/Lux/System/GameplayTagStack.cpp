@@ -2,12 +2,215 @@
 #include "System/GameplayTagStack.h"
 #include "ActionSystem/ActionSystemComponent.h" // 델리게이트 호출을 위해 포함
 #include "LuxLogChannels.h"
+#include "GameplayTagsManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/UObjectIterator.h"
+#include "Engine/World.h"
+
+namespace LuxTagStackNet
+{
+    static void DumpStatsCommand(const TArray<FString>& Args, UWorld* World)
+    {
+        for (TObjectIterator<UActionSystemComponent> It; It; ++It)
+        {
+            const UActionSystemComponent* ASC = *It;
+            if (!IsValid(ASC) || ASC->GetWorld() != World)
+            {
+                continue;
+            }
+
+            const FGameplayTagStackNetStats& Stats = ASC->GetGameplayTagsNetStats();
+            UE_LOG(LogLux, Log, TEXT("[%s] 송신 %llu bits / %u 회 (평균 %.1f), 수신 %llu bits / %u 회 (평균 %.1f)"),
+                *GetNameSafe(ASC->GetOwner()),
+                Stats.BitsWritten, Stats.NumWrites, Stats.NumWrites > 0 ? static_cast<double>(Stats.BitsWritten) / Stats.NumWrites : 0.0,
+                Stats.BitsRead, Stats.NumReads, Stats.NumReads > 0 ? static_cast<double>(Stats.BitsRead) / Stats.NumReads : 0.0);
+        }
+    }
+
+    static FAutoConsoleCommandWithWorldAndArgs DumpStatsConsoleCommand(
+        TEXT("Lux.Net.DumpTagStackStats"),
+        TEXT("현재 월드의 ActionSystemComponent 별 게임플레이 태그 스택 복제 대역폭을 출력합니다."),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DumpStatsCommand));
+}
+
+FGameplayTagBitSet FGameplayTagBitSet::FromTags(const FGameplayTagContainer& Tags)
+{
+    FGameplayTagBitSet Result;
+    for (const FGameplayTag& Tag : Tags)
+    {
+        Result.SetBit(GetBitIndex(Tag));
+    }
+    return Result;
+}
+
+int32 FGameplayTagBitSet::GetBitIndex(const FGameplayTag& Tag)
+{
+    if (!Tag.IsValid())
+    {
+        return INDEX_NONE;
+    }
+
+    const FGameplayTagNetIndex NetIndex = UGameplayTagsManager::Get().GetNetIndexFromTag(Tag);
+    return NetIndex != INVALID_TAGNETINDEX ? static_cast<int32>(NetIndex) : INDEX_NONE;
+}
+
+void FGameplayTagBitSet::SetBit(int32 BitIndex)
+{
+    if (BitIndex < 0)
+    {
+        return;
+    }
+
+    const int32 WordIndex = BitIndex >> 6;
+    if (WordIndex >= Words.Num())
+    {
+        Words.SetNumZeroed(WordIndex + 1);
+    }
+    Words[WordIndex] |= (1ull << (BitIndex & 63));
+}
+
+void FGameplayTagBitSet::ClearBit(int32 BitIndex)
+{
+    const int32 WordIndex = BitIndex >> 6;
+    if (BitIndex >= 0 && Words.IsValidIndex(WordIndex))
+    {
+        Words[WordIndex] &= ~(1ull << (BitIndex & 63));
+    }
+}
+
+bool FGameplayTagBitSet::HasAny(const FGameplayTagBitSet& Other) const
+{
+    const int32 NumWords = FMath::Min(Words.Num(), Other.Words.Num());
+    for (int32 WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+    {
+        if ((Words[WordIndex] & Other.Words[WordIndex]) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FGameplayTagBitSet::HasAll(const FGameplayTagBitSet& Other) const
+{
+    for (int32 WordIndex = 0; WordIndex < Other.Words.Num(); ++WordIndex)
+    {
+        const uint64 Mine = Words.IsValidIndex(WordIndex) ? Words[WordIndex] : 0;
+        if ((Mine & Other.Words[WordIndex]) != Other.Words[WordIndex])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FGameplayTagBitSet::IsEmpty() const
+{
+    for (const uint64 Word : Words)
+    {
+        if (Word != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+/** 태그들을 비트로 변환합니다. 네트워크 인덱스가 없는 태그가 하나라도 있으면 false 를 반환합니다. */
+static bool CompileQueryBits(const FGameplayTagContainer& Tags, FGameplayTagBitSet& OutBits)
+{
+    bool bAllIndexed = true;
+    for (const FGameplayTag& Tag : Tags)
+    {
+        const int32 BitIndex = FGameplayTagBitSet::GetBitIndex(Tag);
+        if (BitIndex == INDEX_NONE)
+        {
+            bAllIndexed = false;
+            continue;
+        }
+        OutBits.SetBit(BitIndex);
+    }
+    return bAllIndexed;
+}
+
+FLuxCompiledTagQuery FLuxCompiledTagQuery::Compile(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags)
+{
+    FLuxCompiledTagQuery Query;
+    Query.CompileFrom(InRequireAllTags, InRequireAnyTags, InRequireNoneTags);
+    return Query;
+}
+
+const FLuxCompiledTagQuery& FLuxCompiledTagQuery::GetOrCompile(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags) const
+{
+    if (!bCompiled)
+    {
+        CompileFrom(InRequireAllTags, InRequireAnyTags, InRequireNoneTags);
+    }
+
+    return *this;
+}
+
+void FLuxCompiledTagQuery::CompileFrom(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags) const
+{
+    RequireAllTags = InRequireAllTags;
+    RequireAnyTags = InRequireAnyTags;
+    RequireNoneTags = InRequireNoneTags;
+
+    // 세 조건을 모두 컴파일해야 하므로 단락 평가(&&)를 사용하지 않습니다.
+    const bool bAllValid = CompileQueryBits(InRequireAllTags, AllBits);
+    const bool bAnyValid = CompileQueryBits(InRequireAnyTags, AnyBits);
+    const bool bNoneValid = CompileQueryBits(InRequireNoneTags, NoneBits);
+    bBitsValid = bAllValid && bAnyValid && bNoneValid;
+    bCompiled = true;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
 
 FString FGameplayTagStack::GetDebugString() const
 {
     return FString::Printf(TEXT("%s(%d)"), *Tag.ToString(), StackCount);
 }
 
+bool FGameplayTagStack::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    bOutSuccess = true;
+
+    // 0 은 '네트워크 인덱스 없음'을 뜻하므로 인덱스에 1 을 더해 보냅니다.
+    uint32 PackedNetIndex = 0;
+    if (Ar.IsSaving())
+    {
+        const int32 NetIndex = FGameplayTagBitSet::GetBitIndex(Tag);
+        PackedNetIndex = NetIndex != INDEX_NONE ? static_cast<uint32>(NetIndex) + 1 : 0;
+    }
+    Ar.SerializeIntPacked(PackedNetIndex);
+
+    if (PackedNetIndex == 0)
+    {
+        // 태그 테이블에 없는 태그는 기본 태그 직렬화로 보냅니다.
+        Tag.NetSerialize(Ar, Map, bOutSuccess);
+    }
+    else if (Ar.IsLoading())
+    {
+        const FName TagName = UGameplayTagsManager::Get().GetTagNameFromNetIndex(static_cast<FGameplayTagNetIndex>(PackedNetIndex - 1));
+        Tag = FGameplayTag::RequestGameplayTag(TagName, false);
+        bOutSuccess = Tag.IsValid();
+    }
+
+    // 복제되는 스택 수는 항상 1 이상이고 대부분 작으므로 가변 길이 정수로 1 바이트에 담깁니다.
+    uint32 PackedStackCount = static_cast<uint32>(FMath::Max(StackCount, 0));
+    Ar.SerializeIntPacked(PackedStackCount);
+    if (Ar.IsLoading())
+    {
+        StackCount = static_cast<int32>(PackedStackCount);
+    }
+
+    return bOutSuccess;
+}
+
 void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
 {
     if (StackCount <= 0)
@@ -21,28 +224,30 @@ void FGameplayTagStackContainer::AddStack(FGameplayTag Tag, int32 StackCount)
         return;
     }
 
+    OnTagCountChanged(Tag, StackCount);
+
     // 먼저 맵에서 찾아보고, 있으면 스택 수만 업데이트합니다.
     if (int32* ExistingCount = TagToCountMap.Find(Tag))
     {
         *ExistingCount += StackCount;
 
-        // 배열에서도 찾아서 스택 수를 업데이트하고 Dirty로 마킹합니다.
-        for (FGameplayTagStack& Stack : Stacks)
+        // 인덱스 맵으로 배열 항목을 바로 찾아 스택 수를 업데이트하고 Dirty로 마킹합니다.
+        const int32 Index = FindStackIndex(Tag);
+        if (Stacks.IsValidIndex(Index))
         {
-            if (Stack.Tag == Tag)
-            {
-                Stack.StackCount = *ExistingCount;
-                MarkItemDirty(Stack);
-                return;
-            }
+            FGameplayTagStack& Stack = Stacks[Index];
+            Stack.StackCount = *ExistingCount;
+            MarkItemDirty(Stack);
         }
     }
     else // 맵에 없다면 새로운 스택입니다.
     {
         TagToCountMap.Add(Tag, StackCount);
+        OnExplicitTagAdded(Tag);
 
+        TagToIndexMap.Add(Tag, Stacks.Num());
         FGameplayTagStack& NewStack = Stacks.Emplace_GetRef(Tag, StackCount);
-        MarkArrayDirty();
+        MarkItemDirty(NewStack);
     }
 }
 
@@ -59,30 +264,66 @@ void FGameplayTagStackContainer::RemoveStack(FGameplayTag Tag, int32 StackCount)
     }
 
     int32& ExistingCount = TagToCountMap.FindChecked(Tag);
+    OnTagCountChanged(Tag, -FMath::Min(StackCount, ExistingCount));
     ExistingCount -= StackCount;
 
     if (ExistingCount <= 0)
     {
         // 스택이 0 이하가 되면 맵과 배열에서 모두 제거합니다.
+        const int32 Index = FindStackIndex(Tag);
         TagToCountMap.Remove(Tag);
-        Stacks.RemoveAll([Tag](const FGameplayTagStack& Stack) { return Stack.Tag == Tag; });
+        TagToIndexMap.Remove(Tag);
+        OnExplicitTagRemoved(Tag);
+
+        if (Stacks.IsValidIndex(Index))
+        {
+            // FastArray 는 ReplicationID 로 항목을 식별하므로 순서를 유지할 필요가 없습니다.
+            Stacks.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+
+            // 마지막 항목이 빈자리로 옮겨졌다면 그 인덱스를 갱신합니다.
+            if (Stacks.IsValidIndex(Index) && !bTagIndexDirty)
+            {
+                TagToIndexMap.Add(Stacks[Index].Tag, Index);
+            }
+        }
         MarkArrayDirty();
     }
     else
     {
-        // 스택이 남아있으면 배열을 찾아서 카운트만 업데이트합니다.
-        for (FGameplayTagStack& Stack : Stacks)
+        // 스택이 남아있으면 배열 항목의 카운트만 업데이트합니다.
+        const int32 Index = FindStackIndex(Tag);
+        if (Stacks.IsValidIndex(Index))
         {
-            if (Stack.Tag == Tag)
-            {
-                Stack.StackCount = ExistingCount;
-                MarkItemDirty(Stack);
-                break;
-            }
+            FGameplayTagStack& Stack = Stacks[Index];
+            Stack.StackCount = ExistingCount;
+            MarkItemDirty(Stack);
         }
     }
 }
 
+int32 FGameplayTagStackContainer::FindStackIndex(const FGameplayTag& Tag) const
+{
+    if (!bTagIndexDirty)
+    {
+        const int32* Index = TagToIndexMap.Find(Tag);
+        return Index ? *Index : INDEX_NONE;
+    }
+
+    // 클라이언트에서 인덱스 재구성이 보류 중이라면 원본 배열에서 검색합니다.
+    return Stacks.IndexOfByPredicate([&Tag](const FGameplayTagStack& Stack) { return Stack.Tag == Tag; });
+}
+
+void FGameplayTagStackContainer::RebuildTagIndexMap()
+{
+    TagToIndexMap.Reset();
+    TagToIndexMap.Reserve(Stacks.Num());
+    for (int32 Index = 0; Index < Stacks.Num(); ++Index)
+    {
+        TagToIndexMap.Add(Stacks[Index].Tag, Index);
+    }
+    bTagIndexDirty = false;
+}
+
 int32 FGameplayTagStackContainer::GetStackCount(FGameplayTag Tag) const
 {
     return TagToCountMap.FindRef(Tag);
@@ -90,6 +331,14 @@ int32 FGameplayTagStackContainer::GetStackCount(FGameplayTag Tag) const
 
 bool FGameplayTagStackContainer::ContainsTag(FGameplayTag Tag) const
 {
+    // 비트셋에는 보유 태그의 모든 부모 비트가 확장되어 있으므로, 계층 일치도 비트 하나로 판단합니다.
+    const int32 BitIndex = FGameplayTagBitSet::GetBitIndex(Tag);
+    if (BitIndex != INDEX_NONE)
+    {
+        return TagBits.Test(BitIndex);
+    }
+
+    // 네트워크 인덱스가 아직 구성되지 않은 경우에만 아래의 순회 경로를 사용합니다.
     if (TagToCountMap.Contains(Tag))
     {
         return true;
@@ -108,26 +357,208 @@ bool FGameplayTagStackContainer::ContainsTag(FGameplayTag Tag) const
     return false;
 }
 
-FGameplayTagContainer FGameplayTagStackContainer::GetExplicitGameplayTags() const
+bool FGameplayTagStackContainer::HasAnyTags(const FGameplayTagContainer& Tags) const
 {
-    FGameplayTagContainer ExplicitTags;
-    for (const auto& TagCountPair : TagToCountMap)
+    for (const FGameplayTag& Tag : Tags)
+    {
+        if (ContainsTag(Tag))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FGameplayTagStackContainer::HasAllTags(const FGameplayTagContainer& Tags) const
+{
+    for (const FGameplayTag& Tag : Tags)
     {
-        if (TagCountPair.Value > 0)
+        if (!ContainsTag(Tag))
         {
-            ExplicitTags.AddTag(TagCountPair.Key);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FGameplayTagStackContainer::MatchesQuery(const FLuxCompiledTagQuery& Query) const
+{
+    if (Query.bBitsValid)
+    {
+        // TagBits 에는 부모 태그 비트까지 설정되어 있으므로 워드 비교만으로 계층 일치가 됩니다.
+        return TagBits.HasAll(Query.AllBits)
+            && (Query.RequireAnyTags.IsEmpty() || TagBits.HasAny(Query.AnyBits))
+            && !TagBits.HasAny(Query.NoneBits);
+    }
+
+    // 네트워크 인덱스가 구성되기 전에 컴파일된 질의는 컨테이너 경로로 평가합니다.
+    return HasAllTags(Query.RequireAllTags)
+        && (Query.RequireAnyTags.IsEmpty() || HasAnyTags(Query.RequireAnyTags))
+        && !HasAnyTags(Query.RequireNoneTags);
+}
+
+void FGameplayTagStackContainer::OnExplicitTagAdded(const FGameplayTag& Tag)
+{
+    CachedExplicitTags.AddTag(Tag);
+    ++TagsVersion;
+
+    // 자신부터 루트까지 올라가며 각 비트의 참조 수를 증가시킵니다.
+    for (FGameplayTag Current = Tag; Current.IsValid(); Current = Current.RequestDirectParent())
+    {
+        const int32 BitIndex = FGameplayTagBitSet::GetBitIndex(Current);
+        if (BitIndex == INDEX_NONE)
+        {
+            continue;
+        }
+
+        if (BitIndex >= TagBitRefCounts.Num())
+        {
+            TagBitRefCounts.SetNumZeroed(BitIndex + 1);
+        }
+
+        if (TagBitRefCounts[BitIndex]++ == 0)
+        {
+            TagBits.SetBit(BitIndex);
+        }
+    }
+}
+
+void FGameplayTagStackContainer::OnExplicitTagRemoved(const FGameplayTag& Tag)
+{
+    CachedExplicitTags.RemoveTag(Tag);
+    ++TagsVersion;
+
+    for (FGameplayTag Current = Tag; Current.IsValid(); Current = Current.RequestDirectParent())
+    {
+        const int32 BitIndex = FGameplayTagBitSet::GetBitIndex(Current);
+        if (!TagBitRefCounts.IsValidIndex(BitIndex) || TagBitRefCounts[BitIndex] <= 0)
+        {
+            continue;
+        }
+
+        if (--TagBitRefCounts[BitIndex] == 0)
+        {
+            TagBits.ClearBit(BitIndex);
         }
     }
-    return ExplicitTags;
 }
 
 void FGameplayTagStackContainer::Reset()
 {
+    for (const TPair<FGameplayTag, int32>& TagCountPair : TagToCountMap)
+    {
+        OnTagCountChanged(TagCountPair.Key, -TagCountPair.Value);
+    }
+
     TagToCountMap.Empty();
+    TagToIndexMap.Empty();
+    bTagIndexDirty = false;
+    TagBits.Reset();
+    TagBitRefCounts.Reset();
+    CachedExplicitTags.Reset();
+    ++TagsVersion;
     Stacks.Empty();
     MarkArrayDirty();
 }
 
+FOnGameplayTagCountChangedNative& FGameplayTagStackContainer::RegisterTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType)
+{
+    FTagSubscription* Subscription = TagSubscriptions.Find(Tag);
+    if (!Subscription)
+    {
+        Subscription = &TagSubscriptions.Add(Tag);
+
+        // 처음 구독되는 태그라면 현재 보유 중인 자식 태그까지 포함한 스택 수를 한 번만 계산합니다.
+        for (const TPair<FGameplayTag, int32>& TagCountPair : TagToCountMap)
+        {
+            if (TagCountPair.Key.MatchesTag(Tag))
+            {
+                Subscription->Count += TagCountPair.Value;
+            }
+        }
+    }
+
+    return EventType == ELuxTagEventType::NewOrRemoved ? Subscription->OnNewOrRemoved : Subscription->OnAnyCountChange;
+}
+
+void FGameplayTagStackContainer::UnregisterTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType, FDelegateHandle DelegateHandle)
+{
+    FTagSubscription* Subscription = TagSubscriptions.Find(Tag);
+    if (!Subscription)
+    {
+        return;
+    }
+
+    FOnGameplayTagCountChangedNative& Delegate = EventType == ELuxTagEventType::NewOrRemoved ? Subscription->OnNewOrRemoved : Subscription->OnAnyCountChange;
+    Delegate.Remove(DelegateHandle);
+
+    // 남은 구독자가 없다면 이후 변경에서 부모 탐색 비용이 들지 않도록 항목을 제거합니다.
+    if (!Subscription->OnNewOrRemoved.IsBound() && !Subscription->OnAnyCountChange.IsBound())
+    {
+        TagSubscriptions.Remove(Tag);
+    }
+}
+
+void FGameplayTagStackContainer::OnTagCountChanged(const FGameplayTag& Tag, int32 Delta)
+{
+    if (Delta == 0 || TagSubscriptions.Num() == 0)
+    {
+        return;
+    }
+
+    // 자신부터 루트까지 올라가며 구독 중인 태그의 스택 수 합을 갱신합니다.
+    for (FGameplayTag Current = Tag; Current.IsValid(); Current = Current.RequestDirectParent())
+    {
+        FTagSubscription* Subscription = TagSubscriptions.Find(Current);
+        if (!Subscription)
+        {
+            continue;
+        }
+
+        if (!Subscription->bPending)
+        {
+            Subscription->bPending = true;
+            Subscription->CountBeforeFlush = Subscription->Count;
+            PendingTagChanges.Add(Current);
+        }
+        Subscription->Count += Delta;
+    }
+}
+
+void FGameplayTagStackContainer::FlushTagChangeNotifications()
+{
+    // 알림 도중 발생한 변경은 다음 플러시에서 처리되도록 목록을 분리합니다.
+    const TArray<FGameplayTag> TagsToNotify = MoveTemp(PendingTagChanges);
+    PendingTagChanges.Reset();
+
+    for (const FGameplayTag& Tag : TagsToNotify)
+    {
+        FTagSubscription* Subscription = TagSubscriptions.Find(Tag);
+        if (!Subscription || !Subscription->bPending)
+        {
+            continue;
+        }
+
+        Subscription->bPending = false;
+
+        // 같은 프레임 안에서 추가 후 제거되어 순 변화가 없다면 알리지 않습니다.
+        const int32 OldCount = Subscription->CountBeforeFlush;
+        const int32 NewCount = Subscription->Count;
+        if (OldCount == NewCount)
+        {
+            continue;
+        }
+
+        // 브로드캐스트 중 구독이 해제되면 맵이 바뀔 수 있으므로 델리게이트를 복사해 둡니다.
+        const bool bPresenceChanged = (OldCount > 0) != (NewCount > 0);
+        const FOnGameplayTagCountChangedNative OnAnyCountChange = Subscription->OnAnyCountChange;
+        const FOnGameplayTagCountChangedNative OnNewOrRemoved = bPresenceChanged ? Subscription->OnNewOrRemoved : FOnGameplayTagCountChangedNative();
+
+        OnAnyCountChange.Broadcast(Tag, NewCount);
+        OnNewOrRemoved.Broadcast(Tag, NewCount);
+    }
+}
+
 
 // --- FastArraySerializer 콜백 함수들 ---
 
@@ -135,10 +566,17 @@ void FGameplayTagStackContainer::PreReplicatedRemove(const TArrayView<int32> Rem
 {
     const bool bIsClient = (OwnerComponent->GetOwnerRole() != ROLE_Authority);
 
+    // 제거 직후 FastArray 가 항목을 RemoveAtSwap 으로 재배치하므로 수신 완료 시점에 인덱스 맵을 다시 구성합니다.
+    bTagIndexDirty = true;
+
     for (const int32 Index : RemovedIndices)
     {
         const FGameplayTagStack& Stack = Stacks[Index];
-        TagToCountMap.Remove(Stack.Tag);
+        OnTagCountChanged(Stack.Tag, -TagToCountMap.FindRef(Stack.Tag));
+        if (TagToCountMap.Remove(Stack.Tag) > 0)
+        {
+            OnExplicitTagRemoved(Stack.Tag);
+        }
 
         // 태그가 제거되었음을 클라이언트의 다른 시스템에 알립니다.
         if (OwnerComponent.IsValid() && bIsClient)
@@ -155,7 +593,13 @@ void FGameplayTagStackContainer::PostReplicatedAdd(const TArrayView<int32> Added
     for (const int32 Index : AddedIndices)
     {
         const FGameplayTagStack& Stack = Stacks[Index];
+        OnTagCountChanged(Stack.Tag, Stack.StackCount - TagToCountMap.FindRef(Stack.Tag));
+        if (!TagToCountMap.Contains(Stack.Tag))
+        {
+            OnExplicitTagAdded(Stack.Tag);
+        }
         TagToCountMap.Add(Stack.Tag, Stack.StackCount);
+        TagToIndexMap.Add(Stack.Tag, Index);
 
         if (OwnerComponent.IsValid() && bIsClient)
         {
@@ -178,6 +622,56 @@ void FGameplayTagStackContainer::PostReplicatedChange(const TArrayView<int32> Ch
             OwnerComponent->OnGameplayTagStackChanged.Broadcast(Stack.Tag, OldCount, Stack.StackCount);
         }
 
+        OnTagCountChanged(Stack.Tag, Stack.StackCount - TagToCountMap.FindRef(Stack.Tag));
+        if (!TagToCountMap.Contains(Stack.Tag))
+        {
+            OnExplicitTagAdded(Stack.Tag);
+        }
         TagToCountMap.FindOrAdd(Stack.Tag) = Stack.StackCount;
+        TagToIndexMap.Add(Stack.Tag, Index);
+    }
+}
+
+bool FGameplayTagStackContainer::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+    const int64 WriterBitsBefore = DeltaParms.Writer ? DeltaParms.Writer->GetNumBits() : 0;
+    const int64 ReaderBitsBefore = DeltaParms.Reader ? DeltaParms.Reader->GetPosBits() : 0;
+
+    const bool bResult = FFastArraySerializer::FastArrayDeltaSerialize<FGameplayTagStack, FGameplayTagStackContainer>(Stacks, DeltaParms, *this);
+
+    // 변경 사항이 없어 아무것도 쓰지 않은 호출은 집계하지 않습니다.
+    if (DeltaParms.Writer)
+    {
+        const int64 BitsWritten = DeltaParms.Writer->GetNumBits() - WriterBitsBefore;
+        if (BitsWritten > 0)
+        {
+            NetStats.BitsWritten += BitsWritten;
+            ++NetStats.NumWrites;
+        }
+    }
+    else if (DeltaParms.Reader)
+    {
+        const int64 BitsRead = DeltaParms.Reader->GetPosBits() - ReaderBitsBefore;
+        if (BitsRead > 0)
+        {
+            NetStats.BitsRead += BitsRead;
+            ++NetStats.NumReads;
+        }
+    }
+
+    return bResult;
+}
+
+void FGameplayTagStackContainer::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (bTagIndexDirty)
+    {
+        RebuildTagIndexMap();
+    }
+
+    // 이동 차단처럼 다음 틱까지 기다릴 수 없는 상태는 수신 직후 바로 반영합니다.
+    if (OwnerComponent.IsValid())
+    {
+        OwnerComponent->RefreshMovementBlocked();
     }
 }
\ No newline at end of file
@@ -10,6 +10,102 @@ class UActionSystemComponent;
 struct FGameplayTagStackContainer;
 struct FNetDeltaSerializeInfo;
 
+/** 태그 구독 이벤트의 종류입니다. */
+enum class ELuxTagEventType : uint8
+{
+    /** 태그(또는 자식 태그)의 스택 수가 0 을 넘나들 때만 호출됩니다. */
+    NewOrRemoved,
+
+    /** 태그(또는 자식 태그)의 스택 수가 바뀔 때마다 호출됩니다. */
+    AnyCountChange
+};
+
+/** 태그 스택 수 변경 알림. NewCount 는 태그와 그 자식 태그들의 스택 수 합입니다. */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnGameplayTagCountChangedNative, const FGameplayTag& /*Tag*/, int32 /*NewCount*/);
+
+/**
+ * @struct FGameplayTagBitSet
+ * @brief 게임플레이 태그 네트워크 인덱스를 비트 위치로 사용하는 비트셋입니다.
+ * 여러 태그에 대한 Any/All 질의를 64비트 워드 단위 연산으로 처리합니다.
+ */
+struct LUX_API FGameplayTagBitSet
+{
+public:
+    /** 컨테이너의 태그들을 부모 확장 없이 그대로 비트로 변환합니다. (질의용 마스크) */
+    static FGameplayTagBitSet FromTags(const FGameplayTagContainer& Tags);
+
+    /** 태그의 네트워크 인덱스를 반환합니다. 유효하지 않으면 INDEX_NONE 을 반환합니다. */
+    static int32 GetBitIndex(const FGameplayTag& Tag);
+
+    void SetBit(int32 BitIndex);
+    void ClearBit(int32 BitIndex);
+
+    bool Test(int32 BitIndex) const
+    {
+        const int32 WordIndex = BitIndex >> 6;
+        return BitIndex >= 0 && Words.IsValidIndex(WordIndex) && (Words[WordIndex] & (1ull << (BitIndex & 63))) != 0;
+    }
+
+    /** Other 의 비트 중 하나라도 설정되어 있으면 true 를 반환합니다. */
+    bool HasAny(const FGameplayTagBitSet& Other) const;
+
+    /** Other 의 비트가 모두 설정되어 있으면 true 를 반환합니다. (Other 가 비어 있으면 true) */
+    bool HasAll(const FGameplayTagBitSet& Other) const;
+
+    bool IsEmpty() const;
+    void Reset() { Words.Reset(); }
+
+private:
+    TArray<uint64, TInlineAllocator<8>> Words;
+};
+
+/**
+ * @struct FLuxCompiledTagQuery
+ * @brief RequireAll / RequireAny / RequireNone 조건을 미리 비트 마스크로 컴파일해 둔 태그 질의입니다.
+ * 에셋 로드나 스펙 생성 시 한 번만 만들고, 평가 시에는 태그 스택 컨테이너의 비트셋과 워드 단위로 비교합니다.
+ * 에셋의 조건을 캐시할 때는 멤버로 두고 GetOrCompile 로 처음 사용할 때 컴파일하며, 조건이 바뀌면 Invalidate 합니다.
+ */
+struct LUX_API FLuxCompiledTagQuery
+{
+public:
+    /** 조건 컨테이너들로부터 질의를 컴파일합니다. 비어 있는 컨테이너의 조건은 검사하지 않습니다. */
+    static FLuxCompiledTagQuery Compile(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags);
+
+    /** 아직 컴파일되지 않았다면 주어진 조건으로 컴파일하고, 컴파일된 자신을 반환합니다. */
+    const FLuxCompiledTagQuery& GetOrCompile(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags) const;
+
+    /** 조건이 바뀌었을 때 호출하여 다음 GetOrCompile 에서 다시 컴파일하도록 합니다. */
+    void Invalidate() { bCompiled = false; }
+
+    /** 검사할 조건이 하나도 없는지 확인합니다. (빈 질의는 항상 일치합니다.) */
+    bool IsEmpty() const { return RequireAllTags.IsEmpty() && RequireAnyTags.IsEmpty() && RequireNoneTags.IsEmpty(); }
+
+    const FGameplayTagContainer& GetRequireAllTags() const { return RequireAllTags; }
+    const FGameplayTagContainer& GetRequireAnyTags() const { return RequireAnyTags; }
+    const FGameplayTagContainer& GetRequireNoneTags() const { return RequireNoneTags; }
+
+private:
+    friend FGameplayTagStackContainer;
+
+    /** 조건 컨테이너들을 이 질의에 컴파일합니다. GetOrCompile 이 const 경로에서 캐시를 채울 수 있도록 멤버는 mutable 입니다. */
+    void CompileFrom(const FGameplayTagContainer& InRequireAllTags, const FGameplayTagContainer& InRequireAnyTags, const FGameplayTagContainer& InRequireNoneTags) const;
+
+    /** 비트 마스크를 사용할 수 없을 때의 대체 경로와 로그 출력을 위한 원본 조건입니다. */
+    mutable FGameplayTagContainer RequireAllTags;
+    mutable FGameplayTagContainer RequireAnyTags;
+    mutable FGameplayTagContainer RequireNoneTags;
+
+    mutable FGameplayTagBitSet AllBits;
+    mutable FGameplayTagBitSet AnyBits;
+    mutable FGameplayTagBitSet NoneBits;
+
+    /** 모든 태그가 네트워크 인덱스를 가져 비트 마스크만으로 평가할 수 있는지 여부 */
+    mutable bool bBitsValid = false;
+
+    /** 조건이 컴파일되었는지 여부 */
+    mutable bool bCompiled = false;
+};
+
 /**
  * @struct FGameplayTagStack
  * @brief 단일 게임플레이 태그와 스택 수를 저장하며 FastArraySerializer를 통해 복제됩니다.
@@ -29,6 +125,9 @@ public:
 
     FString GetDebugString() const;
 
+    /** 태그를 네트워크 인덱스로, 스택 수를 가변 길이 정수로 직렬화합니다. */
+    bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
 private:
     friend FGameplayTagStackContainer;
 
@@ -39,6 +138,27 @@ private:
     int32 StackCount = 0;
 };
 
+template<>
+struct TStructOpsTypeTraits<FGameplayTagStack> : public TStructOpsTypeTraitsBase2<FGameplayTagStack>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+/** 태그 스택 컨테이너 하나의 복제 대역폭 누적 통계입니다. (비복제) */
+struct FGameplayTagStackNetStats
+{
+    /** 송신한 델타의 누적 비트 수와 횟수 */
+    uint64 BitsWritten = 0;
+    uint32 NumWrites = 0;
+
+    /** 수신한 델타의 누적 비트 수와 횟수 */
+    uint64 BitsRead = 0;
+    uint32 NumReads = 0;
+};
+
 /**
  * @struct FGameplayTagStackContainer
  * @brief 스택을 지원하는 게임플레이 태그 컨테이너입니다. 
@@ -58,26 +178,63 @@ public:
     /** 지정된 태그의 현재 스택 수를 반환합니다. (없으면 0) */
     int32 GetStackCount(FGameplayTag Tag) const;
 
-    /** 지정된 태그의 스택이 하나라도 존재하는지 확인합니다. */
+    /** 지정된 태그 또는 그 자식 태그의 스택이 하나라도 존재하는지 확인합니다. */
     bool ContainsTag(FGameplayTag Tag) const;
 
-    /** 컨테이너가 가진 모든 태그를 FGameplayTagContainer 형태로 반환합니다. */
-    FGameplayTagContainer GetExplicitGameplayTags() const;
+    /** 지정된 태그 중 하나라도 (계층 일치로) 존재하는지 확인합니다. */
+    bool HasAnyTags(const FGameplayTagContainer& Tags) const;
+
+    /** 지정된 태그가 모두 (계층 일치로) 존재하는지 확인합니다. */
+    bool HasAllTags(const FGameplayTagContainer& Tags) const;
+
+    /** 미리 만들어 둔 질의 마스크로 워드 단위 Any/All 검사를 수행합니다. */
+    bool HasAnyTags(const FGameplayTagBitSet& QueryBits) const { return TagBits.HasAny(QueryBits); }
+    bool HasAllTags(const FGameplayTagBitSet& QueryBits) const { return TagBits.HasAll(QueryBits); }
+
+    /** 컴파일된 질의의 All/Any/None 조건을 (계층 일치로) 모두 만족하는지 확인합니다. */
+    bool MatchesQuery(const FLuxCompiledTagQuery& Query) const;
+
+    /** 컨테이너가 가진 모든 태그를 FGameplayTagContainer 형태로 반환합니다. (캐시된 컨테이너이므로 복사 비용이 없습니다.) */
+    const FGameplayTagContainer& GetExplicitGameplayTags() const { return CachedExplicitTags; }
+
+    /** 보유 태그 집합이 바뀔 때마다(스택 수가 0 을 넘나들 때) 증가하는 버전입니다. */
+    uint32 GetTagsVersion() const { return TagsVersion; }
+
+    /** 지정한 버전 이후로 보유 태그 집합이 바뀌었는지 확인합니다. */
+    bool HasTagsChangedSince(uint32 Version) const { return TagsVersion != Version; }
 
     /** 모든 태그 스택과 내부 캐시를 초기화합니다. (복제용 배열까지 비움) */
     void Reset();
 
+    /**
+     * 지정한 태그의 스택 수 변경 알림 델리게이트를 반환합니다. 자식 태그의 변경도 부모 태그 구독자에게 전달됩니다.
+     * 알림은 FlushTagChangeNotifications() 에서 태그별로 한 번, 순 변화량 기준으로만 호출됩니다.
+     */
+    FOnGameplayTagCountChangedNative& RegisterTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType);
+
+    /** RegisterTagEvent 로 등록한 델리게이트를 해제합니다. */
+    void UnregisterTagEvent(const FGameplayTag& Tag, ELuxTagEventType EventType, FDelegateHandle DelegateHandle);
+
+    /** 보류 중인 태그 변경 알림이 있는지 확인합니다. */
+    bool HasPendingTagChangeNotifications() const { return PendingTagChanges.Num() > 0; }
+
+    /** 이번 프레임 동안 누적된 태그 변경을 구독자에게 한 번씩 전달합니다. */
+    void FlushTagChangeNotifications();
+
     //~ FFastArraySerializer interface
     void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
     void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
     void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
     //~ End of FFastArraySerializer interface
 
 public:
-    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
-    {
-        return FFastArraySerializer::FastArrayDeltaSerialize<FGameplayTagStack, FGameplayTagStackContainer>(Stacks, DeltaParms, *this);
-    }
+    /** 변경된 항목만 델타로 직렬화하고, 이 컨테이너의 송수신 비트 수를 누적합니다. */
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+    /** 이 컨테이너의 복제 대역폭 누적 통계를 반환합니다. */
+    const FGameplayTagStackNetStats& GetNetStats() const { return NetStats; }
+    void ResetNetStats() { NetStats = FGameplayTagStackNetStats(); }
 
     UPROPERTY(Transient)
     TWeakObjectPtr<UActionSystemComponent> OwnerComponent;
@@ -89,6 +246,61 @@ private:
 
     /** 빠른 조회를 위한 비복제 맵 캐시입니다. */
     TMap<FGameplayTag, int32> TagToCountMap;
+
+    /** 태그 → Stacks 배열 인덱스 (비복제). 제거 시 RemoveAtSwap 으로 옮겨진 항목의 인덱스도 함께 갱신합니다. */
+    TMap<FGameplayTag, int32> TagToIndexMap;
+
+    /** 클라이언트 수신 중 FastArray 가 배열을 재배치하여 인덱스 맵을 다시 구성해야 하는지 여부 */
+    bool bTagIndexDirty = false;
+
+    /** 태그에 해당하는 Stacks 인덱스를 반환합니다. (없으면 INDEX_NONE) */
+    int32 FindStackIndex(const FGameplayTag& Tag) const;
+
+    /** Stacks 배열로부터 인덱스 맵을 다시 구성합니다. */
+    void RebuildTagIndexMap();
+
+    /** 태그의 스택 수가 0 에서 양수가 되거나 0 이 될 때 호출되어 비트셋, 캐시된 컨테이너, 버전을 갱신합니다. */
+    void OnExplicitTagAdded(const FGameplayTag& Tag);
+    void OnExplicitTagRemoved(const FGameplayTag& Tag);
+
+    /** 보유한 태그와 그 모든 부모 태그의 비트셋 (비복제) */
+    FGameplayTagBitSet TagBits;
+
+    /** 비트별 참조 수. 여러 자식 태그가 같은 부모 비트를 공유하므로 필요합니다. */
+    TArray<int32> TagBitRefCounts;
+
+    /** 스택 수가 1 이상인 태그들의 캐시 (비복제) */
+    FGameplayTagContainer CachedExplicitTags;
+
+    /** 보유 태그 집합 버전 (비복제) */
+    uint32 TagsVersion = 0;
+
+    /** 태그 하나에 대한 구독 정보입니다. */
+    struct FTagSubscription
+    {
+        /** 태그와 자식 태그들의 현재 스택 수 합 */
+        int32 Count = 0;
+
+        /** 이번 프레임 첫 변경 직전의 스택 수 합 */
+        int32 CountBeforeFlush = 0;
+
+        bool bPending = false;
+
+        FOnGameplayTagCountChangedNative OnNewOrRemoved;
+        FOnGameplayTagCountChangedNative OnAnyCountChange;
+    };
+
+    /** 태그의 스택 수가 Delta 만큼 바뀌었을 때, 자신과 부모 태그의 구독 정보를 갱신하고 알림을 보류합니다. */
+    void OnTagCountChanged(const FGameplayTag& Tag, int32 Delta);
+
+    /** 태그별 구독 정보 (비복제) */
+    TMap<FGameplayTag, FTagSubscription> TagSubscriptions;
+
+    /** 이번 프레임에 변경되어 알림이 보류된 구독 태그 목록 */
+    TArray<FGameplayTag> PendingTagChanges;
+
+    /** 복제 대역폭 누적 통계 (비복제) */
+    FGameplayTagStackNetStats NetStats;
 };
 
 // NetDeltaSerialize를 사용하기 위한 타입 특성(trait) 설정
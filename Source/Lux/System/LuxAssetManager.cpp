@@ -11,6 +11,7 @@
 #include "Targeting/LuxTargetingData.h"
 #include "Targeting/Filters/TargetFilter.h"
 #include "ActionSystem/Effects/LuxEffect.h"
+#include "ActionSystem/Attributes/LuxAttributeSet.h"
 
 #include "AbilitySystemGlobals.h"
 #include "Character/LuxPawnData.h"
@@ -130,6 +131,9 @@ void ULuxAssetManager::StartInitialLoading()
 	
 	// 스탯 맵핑 데이터 캐시 초기화
 	InitializeStatMappingDataCache();
+
+	// 모든 AttributeSet 클래스의 속성 오프셋 테이블 구성
+	FLuxAttributeRegistry::Get().RegisterAllAttributeSetClasses();
 	
 	UE_LOG(LogLux, Log, TEXT("AssetManager 초기 로딩 완료: GameData, EffectData, CueData, CrowdControlData, TargetingData 및 StatMappingData 캐시 초기화됨"));
 }
@@ -170,37 +170,47 @@ bool ULuxCombatManager::ApplyCrowdControl(UActionSystemComponent* SourceASC, UAc
 }
 
 
-bool ULuxCombatManager::ApplyDamage(UActionSystemComponent* SourceASC, UActionSystemComponent* TargetASC, const FLuxEffectSpecHandle& DamageSpecHandle)
+bool ULuxCombatManager::CanApplyDamage(UActionSystemComponent* SourceASC, const FLuxEffectSpecHandle& DamageSpecHandle, const TCHAR* Caller) const
 {
     if (!SourceASC) 
 	{ 
-		UE_LOG(LogLux, Error, TEXT("[%s][%s] SourceASC 가 유효하지 않습니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__));
-		 return false; 
-	}
-
-    if (!TargetASC) 
-	{ 
-		UE_LOG(LogLux, Error, TEXT("[%s][%s] TargetASC 가 유효하지 않습니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__)); 
-		return false;
+		UE_LOG(LogLux, Error, TEXT("[%s][%s] SourceASC 가 유효하지 않습니다."), *GetNameSafe(this), Caller);
+		return false; 
 	}
 
     if (!DamageSpecHandle.IsValid()) 
 	{ 
-		UE_LOG(LogLux, Error, TEXT("[%s][%s] DamageSpecHandle 가 유효하지 않습니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__)); 
+		UE_LOG(LogLux, Error, TEXT("[%s][%s] DamageSpecHandle 가 유효하지 않습니다."), *GetNameSafe(this), Caller); 
 		return false;
 	}
 
 	// 1차 월드 레벨에서 서버 확인
     if (GetWorld()->GetNetMode() != NM_DedicatedServer && GetWorld()->GetNetMode() != NM_ListenServer) 
 	{ 
-		UE_LOG(LogLux, Error, TEXT("[%s][%s] 월드 레벨에서 서버가 아닙니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__)); 
+		UE_LOG(LogLux, Error, TEXT("[%s][%s] 월드 레벨에서 서버가 아닙니다."), *GetNameSafe(this), Caller); 
 		return false;
 	}
 
 	// 2차 SourceASC의 권한 확인
 	if (!SourceASC->GetOwnerActor() || !SourceASC->GetOwnerActor()->HasAuthority()) 
 	{ 
-		UE_LOG(LogLux, Error, TEXT("[%s][%s] SourceASC에 서버 권한이 없습니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__)); 
+		UE_LOG(LogLux, Error, TEXT("[%s][%s] SourceASC에 서버 권한이 없습니다."), *GetNameSafe(this), Caller); 
+		return false;
+	}
+
+	return true;
+}
+
+bool ULuxCombatManager::ApplyDamage(UActionSystemComponent* SourceASC, UActionSystemComponent* TargetASC, const FLuxEffectSpecHandle& DamageSpecHandle)
+{
+    if (!TargetASC) 
+	{ 
+		UE_LOG(LogLux, Error, TEXT("[%s][%s] TargetASC 가 유효하지 않습니다."), *GetNameSafe(this), ANSI_TO_TCHAR(__FUNCTION__)); 
+		return false;
+	}
+
+	if (!CanApplyDamage(SourceASC, DamageSpecHandle, ANSI_TO_TCHAR(__FUNCTION__)))
+	{
 		return false;
 	}
 
@@ -225,6 +235,28 @@ bool ULuxCombatManager::ApplyDamage(UActionSystemComponent* SourceASC, UActionSy
 	return bDamageApplied;
 }
 
+int32 ULuxCombatManager::ApplyDamageToTargets(UActionSystemComponent* SourceASC, const TArray<UActionSystemComponent*>& Targets, const FLuxEffectSpecHandle& DamageSpecHandle)
+{
+	if (Targets.Num() == 0 || !CanApplyDamage(SourceASC, DamageSpecHandle, ANSI_TO_TCHAR(__FUNCTION__)))
+	{
+		return 0;
+	}
+
+	// 시전자 쪽 Execution 은 한 번만 실행되고, 대상별 결과 Spec 에 방어 적용 후의 피해량이 담깁니다.
+	TArray<FLuxEffectTargetResult> Results;
+	const int32 NumApplied = SourceASC->ApplyEffectSpecToTargets(DamageSpecHandle, Targets, Results);
+
+	for (const FLuxEffectTargetResult& Result : Results)
+	{
+		if (Result.bApplied && Result.AppliedSpec.IsValid())
+		{
+			BroadcastDamagedEvent(SourceASC, Result.TargetASC, *Result.AppliedSpec.Get());
+		}
+	}
+
+	return NumApplied;
+}
+
 void ULuxCombatManager::BroadcastDamagedEvent(UActionSystemComponent* SourceASC, UActionSystemComponent* TargetASC, const FLuxEffectSpec& Spec)
 {
     FContextPayload EventPayload;
@@ -261,13 +293,11 @@ void ULuxCombatManager::BroadcastDamagedEvent(UActionSystemComponent* SourceASC,
     const FLuxActionSpecHandle SourceHandle = Spec.ContextHandle.GetSourceAction();
     if (SourceASC && SourceHandle.IsValid())
     {
-        if (const FLuxActionSpec* SourceSpec = SourceASC->FindActionSpecFromHandle(SourceHandle))
+        const FLuxActionSpecSnapshotPtr SourceSnapshot = SourceASC->GetActionSpecSnapshot();
+        if (const FLuxActionSpecSnapshotEntry* SourceSpec = SourceSnapshot.IsValid() ? SourceSnapshot->Find(SourceHandle) : nullptr)
         {
-            if (SourceSpec && SourceSpec->Action)
-            {
-				DamageEventData.SourceActionTag = SourceSpec->Action->ActionIdentifierTag;
-				DamageEventData.SourceActionTypeTag = SourceSpec->Action->ActionTags.First();
-            }
+			DamageEventData.SourceActionTag = SourceSpec->ActionIdentifierTag;
+			DamageEventData.SourceActionTypeTag = SourceSpec->ActionTags.First();
         }
     }
     
@@ -298,12 +328,10 @@ void ULuxCombatManager::RecordCombatLog(const FLuxEffectSpec& Spec, float FinalD
 	const FLuxActionSpecHandle SourceActionSpecHandle = Spec.ContextHandle.GetSourceAction();
 	if (SourceActionSpecHandle.IsValid())
 	{
-		if (const FLuxActionSpec* SourceActionSpec = Spec.ContextHandle.GetSourceASC()->FindActionSpecFromHandle(SourceActionSpecHandle))
+		const FLuxActionSpecSnapshotPtr SourceSnapshot = Spec.ContextHandle.GetSourceASC()->GetActionSpecSnapshot();
+		if (const FLuxActionSpecSnapshotEntry* SourceActionSpec = SourceSnapshot.IsValid() ? SourceSnapshot->Find(SourceActionSpecHandle) : nullptr)
 		{
-			if (SourceActionSpec->Action)
-			{
-				LogEntry.SourceActionTag = SourceActionSpec->Action->ActionIdentifierTag;
-			}
+			LogEntry.SourceActionTag = SourceActionSpec->ActionIdentifierTag;
 		}
 	}
 
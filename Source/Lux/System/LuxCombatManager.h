@@ -269,6 +269,16 @@ public:
     */
     bool ApplyDamage(UActionSystemComponent* SourceASC, UActionSystemComponent* TargetASC, const FLuxEffectSpecHandle& DamageSpecHandle);
 
+    /**
+    * 하나의 EffectSpec 을 여러 대상에게 적용합니다. (범위 공격용)
+    * 시전자 쪽 계산은 한 번만 수행하고, 대상마다 방어 적용과 피해 이벤트 방송만 수행합니다.
+    * @param SourceASC - 효과를 발생시킨 컴포넌트입니다.
+    * @param Targets - 효과를 받을 대상 컴포넌트 목록입니다.
+    * @param DamageSpecHandle - 기본 데미지, 스케일링 등 모든 정보가 주입된 이펙트 스펙 핸들입니다. (TargetASC 는 대상마다 설정됩니다)
+    * @return 피해가 적용된 대상 수
+    */
+    int32 ApplyDamageToTargets(UActionSystemComponent* SourceASC, const TArray<UActionSystemComponent*>& Targets, const FLuxEffectSpecHandle& DamageSpecHandle);
+
     /**
      * 전투 로그를 기록합니다.
      * @param Spec - 전투 로그를 기록할 이펙트 스펙입니다.
@@ -312,6 +322,12 @@ public:
     void BroadcastDamagedEvent(UActionSystemComponent* SourceASC, UActionSystemComponent* TargetASC, const struct FLuxEffectSpec& Spec);
 
 private:
+    /**
+     * ApplyDamage/ApplyDamageToTargets 공통 검증입니다. 시전자, 스펙 핸들, 서버 월드, 시전자 권한을 확인하고 실패 사유를 기록합니다.
+     * @param Caller - 로그에 남길 호출 함수 이름입니다.
+     */
+    bool CanApplyDamage(UActionSystemComponent* SourceASC, const FLuxEffectSpecHandle& DamageSpecHandle, const TCHAR* Caller) const;
+
     /* CC 데이터 매핑 맵 */
     UPROPERTY()
     TMap<FGameplayTag, FCrowdControlData> CrowdControlData;
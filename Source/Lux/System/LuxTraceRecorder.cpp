@@ -0,0 +1,202 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "System/LuxTraceRecorder.h"
+#include "LuxLogChannels.h"
+
+#include "GameplayTagsManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformAtomics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryWriter.h"
+#include "Engine/World.h"
+
+
+namespace LuxTrace
+{
+	static int32 GEnabled = 1;
+	static FAutoConsoleVariableRef CVarEnabled(
+		TEXT("Lux.Trace.Enabled"),
+		GEnabled,
+		TEXT("1 이면 액션 시스템 핫패스 이벤트를 월드별 이진 링 버퍼에 기록합니다."));
+
+	/** 덤프 파일 식별자 'LXTR' */
+	static constexpr uint32 FileMagic = 0x5254584C;
+	static constexpr uint32 FileVersion = 2;
+
+	static void DumpCommand(const TArray<FString>& Args, UWorld* World)
+	{
+		ULuxTraceRecorder* Recorder = World ? World->GetSubsystem<ULuxTraceRecorder>() : nullptr;
+		if (!Recorder)
+		{
+			UE_LOG(LogLux, Warning, TEXT("Lux.Trace.Dump: 현재 월드에 트레이스 레코더가 없습니다."));
+			return;
+		}
+
+		const FString FileName = Args.Num() > 0 ? Args[0] : FString::Printf(TEXT("LuxTrace_%s.ltrace"), *FDateTime::Now().ToString());
+		const FString FilePath = FPaths::Combine(FPaths::ProfilingDir(), TEXT("LuxTrace"), FileName);
+		if (Recorder->DumpToFile(FilePath))
+		{
+			UE_LOG(LogLux, Log, TEXT("Lux.Trace.Dump: '%s' 에 트레이스를 기록했습니다."), *FilePath);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs DumpConsoleCommand(
+		TEXT("Lux.Trace.Dump"),
+		TEXT("현재 월드의 액션 시스템 트레이스 링 버퍼를 Saved/Profiling/LuxTrace 에 덤프합니다. 사용법: Lux.Trace.Dump [파일명]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&DumpCommand));
+}
+
+void ULuxTraceRecorder::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	static_assert(FMath::IsPowerOfTwo(Capacity), "Capacity must be a power of two.");
+	Records.SetNumZeroed(Capacity);
+	WriteCursor = 0;
+}
+
+void ULuxTraceRecorder::Deinitialize()
+{
+	Records.Empty();
+	WriteCursor = 0;
+	ObjectIds.Empty();
+	ObjectNames.Empty();
+
+	Super::Deinitialize();
+}
+
+ULuxTraceRecorder* ULuxTraceRecorder::Get(const UObject* WorldContext)
+{
+	if (!LuxTrace::GEnabled || !WorldContext)
+	{
+		return nullptr;
+	}
+
+	const UWorld* World = WorldContext->GetWorld();
+	return World ? World->GetSubsystem<ULuxTraceRecorder>() : nullptr;
+}
+
+int32 ULuxTraceRecorder::GetObjectId(const UObject* Object)
+{
+	if (!Object)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* ExistingId = ObjectIds.Find(FObjectKey(Object)))
+	{
+		return *ExistingId;
+	}
+
+	const int32 NewId = ObjectNames.Add(Object->GetName()) + 1;
+	ObjectIds.Add(FObjectKey(Object), NewId);
+	return NewId;
+}
+
+void ULuxTraceRecorder::Record(ELuxTraceEvent Event, int32 HandleA, int32 HandleB, uint16 Flags,
+	const FGameplayTag& TagA, const FGameplayTag& TagB, float Value0, float Value1, float Value2)
+{
+	if (Records.Num() != Capacity)
+	{
+		return;
+	}
+
+	// 슬롯 예약만 원자적으로 처리하고, 레코드는 예약된 슬롯에 직접 기록합니다.
+	const int64 Cursor = FPlatformAtomics::InterlockedIncrement(&WriteCursor) - 1;
+	FLuxTraceRecord& Entry = Records[static_cast<int32>(Cursor & (Capacity - 1))];
+
+	const UWorld* World = GetWorld();
+	Entry.Time = World ? World->GetTimeSeconds() : 0.0;
+	Entry.Frame = static_cast<uint32>(GFrameCounter);
+	Entry.Event = Event;
+	Entry.Flags = Flags;
+	Entry.HandleA = HandleA;
+	Entry.HandleB = HandleB;
+	Entry.TagA = GetTagNetIndex(TagA);
+	Entry.TagB = GetTagNetIndex(TagB);
+	Entry.Values[0] = Value0;
+	Entry.Values[1] = Value1;
+	Entry.Values[2] = Value2;
+}
+
+bool ULuxTraceRecorder::DumpToFile(const FString& FilePath) const
+{
+	const int64 Total = WriteCursor;
+	const int32 NumRecords = static_cast<int32>(FMath::Min<int64>(Total, Capacity));
+	const int64 FirstCursor = Total - NumRecords;
+
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+
+	uint32 Magic = LuxTrace::FileMagic;
+	uint32 Version = LuxTrace::FileVersion;
+	uint32 RecordSize = sizeof(FLuxTraceRecord);
+	int32 RecordCount = NumRecords;
+	Writer << Magic << Version << RecordSize << RecordCount;
+
+	// 레코드를 오래된 순서대로 기록하면서, 디코딩에 필요한 태그 이름 테이블을 모읍니다.
+	TSet<uint16> UsedTagIndices;
+	TSet<int32> UsedObjectIds;
+	for (int64 Cursor = FirstCursor; Cursor < Total; ++Cursor)
+	{
+		const FLuxTraceRecord& Entry = Records[static_cast<int32>(Cursor & (Capacity - 1))];
+		Writer.Serialize(const_cast<FLuxTraceRecord*>(&Entry), sizeof(FLuxTraceRecord));
+
+		UsedTagIndices.Add(Entry.TagA);
+		UsedTagIndices.Add(Entry.TagB);
+
+		if (HasObjectHandles(Entry.Event))
+		{
+			UsedObjectIds.Add(Entry.HandleA);
+			UsedObjectIds.Add(Entry.HandleB);
+		}
+	}
+
+	const UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	int32 TagCount = UsedTagIndices.Num();
+	Writer << TagCount;
+	for (uint16 NetIndex : UsedTagIndices)
+	{
+		FString TagName = TagsManager.GetTagNameFromNetIndex(NetIndex).ToString();
+		Writer << NetIndex << TagName;
+	}
+
+	// 링에 남아 있는 객체 ID 만 이름 테이블로 기록합니다.
+	UsedObjectIds.Remove(INDEX_NONE);
+	int32 ObjectCount = UsedObjectIds.Num();
+	Writer << ObjectCount;
+	for (int32 ObjectId : UsedObjectIds)
+	{
+		FString ObjectName = ObjectNames.IsValidIndex(ObjectId - 1) ? ObjectNames[ObjectId - 1] : FString();
+		Writer << ObjectId << ObjectName;
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+	{
+		UE_LOG(LogLux, Error, TEXT("ULuxTraceRecorder: '%s' 에 트레이스를 기록하지 못했습니다."), *FilePath);
+		return false;
+	}
+
+	return true;
+}
+
+bool ULuxTraceRecorder::HasObjectHandles(ELuxTraceEvent Event)
+{
+	switch (Event)
+	{
+	case ELuxTraceEvent::ApplyModifiers:
+	case ELuxTraceEvent::HandleCue:
+	case ELuxTraceEvent::HandleCueFailed:
+	case ELuxTraceEvent::DamageExecution:
+		return true;
+	default:
+		return false;
+	}
+}
+
+uint16 ULuxTraceRecorder::GetTagNetIndex(const FGameplayTag& Tag)
+{
+	return Tag.IsValid() ? UGameplayTagsManager::Get().GetNetIndexFromTag(Tag) : INVALID_TAGNETINDEX;
+}
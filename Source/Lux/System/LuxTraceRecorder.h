@@ -0,0 +1,115 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "LuxTraceRecorder.generated.h"
+
+
+/** 트레이스 레코드의 이벤트 종류입니다. 덤프 파일의 디코더와 값을 공유하므로 중간에 항목을 끼워 넣지 마세요. */
+enum class ELuxTraceEvent : uint16
+{
+	None = 0,
+
+	/** ApplyModifiers 시작. HandleA: 대상 액터 ID, HandleB: 시전자 액터 ID, TagA: 이펙트 태그, Flags: DurationPolicy, Values[0]: Spec 레벨 */
+	ApplyModifiers = 1,
+
+	/** Instant Modifier 적용. HandleA: 속성 ID, Flags: 연산, Values: 이전 BaseValue / 새 BaseValue / 크기 */
+	ApplyInstantModifier = 2,
+
+	/** 지속 효과로 인한 속성 재계산 요청. HandleA: 속성 ID */
+	MarkAttributeDirty = 3,
+
+	/** FindActiveEffectFromHandle. HandleA: 이펙트 핸들, HandleB: 찾은 인덱스 (없으면 -1) */
+	FindActiveEffect = 4,
+
+	/** 큐 실행. HandleA: 대상 액터 ID, HandleB: 시전자 액터 ID, TagA: 큐 태그, Flags: 1 이면 풀에서 재사용 */
+	HandleCue = 5,
+
+	/** 큐 인스턴스 생성 실패. HandleA: 대상 액터 ID, HandleB: 시전자 액터 ID, TagA: 큐 태그 */
+	HandleCueFailed = 6,
+
+	/** 데미지 계산 결과. HandleA: 시전자 액터 ID, HandleB: 대상 액터 ID, TagA: 이펙트 태그, Flags: 1 이면 치명타, Values: 물리 피해 / 마법 피해 / 최종 피해 */
+	DamageExecution = 7,
+};
+
+/**
+ * @struct FLuxTraceRecord
+ * @brief 링 버퍼에 저장되는 고정 크기 이진 레코드입니다. 문자열 없이 핸들, 태그 네트워크 인덱스, 실수 값만 저장합니다.
+ */
+struct FLuxTraceRecord
+{
+	double Time = 0.0;
+	uint32 Frame = 0;
+	ELuxTraceEvent Event = ELuxTraceEvent::None;
+	uint16 Flags = 0;
+	int32 HandleA = INDEX_NONE;
+	int32 HandleB = INDEX_NONE;
+
+	/** 태그의 네트워크 인덱스 (FGameplayTagNetIndex) */
+	uint16 TagA = 0;
+	uint16 TagB = 0;
+
+	float Values[3] = { 0.f, 0.f, 0.f };
+};
+
+/**
+ * @class ULuxTraceRecorder
+ * @brief 월드별 액션 시스템 핫패스 이벤트를 고정 크기 이진 링 버퍼에 기록합니다.
+ * 문자열 포매팅 없이 기록하며, 'Lux.Trace.Dump [파일명]' 콘솔 명령으로 Saved/Profiling/LuxTrace 에 덤프하여 오프라인에서 디코딩합니다.
+ */
+UCLASS()
+class LUX_API ULuxTraceRecorder : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ~ UWorldSubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// ~ End of UWorldSubsystem interface
+
+	/** 링 버퍼에 보관하는 최대 레코드 수 (2의 거듭제곱) */
+	static constexpr int32 Capacity = 16384;
+
+	/** WorldContext 가 속한 월드의 레코더를 반환합니다. 트레이스가 비활성화되었으면 nullptr 를 반환합니다. */
+	static ULuxTraceRecorder* Get(const UObject* WorldContext);
+
+	/**
+	 * 레코드의 HandleA/B 에 넣을 객체 ID 를 반환합니다. 객체가 없으면 INDEX_NONE 입니다.
+	 * 처음 본 객체에 이 월드 안에서 1부터 증가하는 일련번호를 부여하고 이름을 함께 보관하므로, GC 후 슬롯이 재사용되어도 겹치지 않고 덤프에서 이름으로 디코딩됩니다.
+	 * 게임 스레드에서만 호출해야 합니다.
+	 */
+	int32 GetObjectId(const UObject* Object);
+
+	/** 레코드를 기록합니다. 시간과 프레임 번호는 자동으로 채워집니다. */
+	void Record(ELuxTraceEvent Event, int32 HandleA = INDEX_NONE, int32 HandleB = INDEX_NONE, uint16 Flags = 0,
+		const FGameplayTag& TagA = FGameplayTag(), const FGameplayTag& TagB = FGameplayTag(),
+		float Value0 = 0.f, float Value1 = 0.f, float Value2 = 0.f);
+
+	/** 현재 링 버퍼의 내용을 오래된 순서대로 파일에 기록합니다. */
+	bool DumpToFile(const FString& FilePath) const;
+
+	/** 지금까지 기록된 전체 레코드 수 (덮어쓴 레코드 포함) */
+	uint64 GetTotalRecorded() const { return static_cast<uint64>(WriteCursor); }
+
+private:
+	static uint16 GetTagNetIndex(const FGameplayTag& Tag);
+
+	/** HandleA/B 에 GetObjectId 로 만든 객체 ID 를 담는 이벤트인지 확인합니다. */
+	static bool HasObjectHandles(ELuxTraceEvent Event);
+
+	TArray<FLuxTraceRecord> Records;
+
+	/** 객체 -> 객체 ID. 객체가 소멸해도 ID 는 재사용하지 않습니다. */
+	TMap<FObjectKey, int32> ObjectIds;
+
+	/** 객체 ID - 1 -> 처음 본 시점의 객체 이름 */
+	TArray<FString> ObjectNames;
+
+	/** 다음에 기록할 위치 (단조 증가, Capacity 로 나눈 나머지가 실제 인덱스) */
+	int64 WriteCursor = 0;
+};
@@ -0,0 +1,92 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TagTargetFilter.h"
+#include "LuxLogChannels.h"
+#include "GameFramework/Actor.h"
+
+#include "ActionSystem/ActionSystemComponent.h"
+#include "ActionSystem/ActionSystemInterface.h"
+
+UTagTargetFilter::UTagTargetFilter()
+{
+	bAllowTargetWithoutASC = false;
+	bDebugLog = false;
+}
+
+#if WITH_EDITOR
+void UTagTargetFilter::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// 조건이 바뀌었으므로 다음 사용 시 다시 컴파일합니다.
+	TagQuery.Invalidate();
+}
+#endif
+
+bool UTagTargetFilter::IsTargetValid(AActor* Target, AActor* SourceActor) const
+{
+	if (::IsValid(Target) == false)
+	{
+		if (bDebugLog)
+		{
+			UE_LOG(LogLux, Warning, TEXT("[TagTargetFilter] Target is null"));
+		}
+		return false;
+	}
+
+	const UActionSystemComponent* ASC = nullptr;
+	if (const IActionSystemInterface* ASCInterface = Cast<IActionSystemInterface>(Target))
+	{
+		ASC = ASCInterface->GetActionSystemComponent();
+	}
+
+	if (!ASC)
+	{
+		ASC = Target->FindComponentByClass<UActionSystemComponent>();
+	}
+
+	if (!ASC)
+	{
+		if (bDebugLog)
+		{
+			UE_LOG(LogLux, Log, TEXT("[TagTargetFilter] %s has no ActionSystemComponent"), *Target->GetName());
+		}
+		return bAllowTargetWithoutASC;
+	}
+
+	const bool bIsValid = ASC->MatchesTagQuery(GetTagQuery());
+
+	if (bDebugLog)
+	{
+		UE_LOG(LogLux, Log, TEXT("[TagTargetFilter] %s: %s"), *Target->GetName(), bIsValid ? TEXT("Passed") : TEXT("Filtered"));
+	}
+
+	return bIsValid;
+}
+
+FString UTagTargetFilter::GetFilterDescription() const
+{
+	TArray<FString> Conditions;
+
+	if (!RequireAllTags.IsEmpty())
+	{
+		Conditions.Add(FString::Printf(TEXT("All: %s"), *RequireAllTags.ToStringSimple()));
+	}
+
+	if (!RequireAnyTags.IsEmpty())
+	{
+		Conditions.Add(FString::Printf(TEXT("Any: %s"), *RequireAnyTags.ToStringSimple()));
+	}
+
+	if (!RequireNoneTags.IsEmpty())
+	{
+		Conditions.Add(FString::Printf(TEXT("None: %s"), *RequireNoneTags.ToStringSimple()));
+	}
+
+	return Conditions.Num() > 0 ? FString::Join(Conditions, TEXT(" / ")) : TEXT("No tag conditions");
+}
+
+const FLuxCompiledTagQuery& UTagTargetFilter::GetTagQuery() const
+{
+	return TagQuery.GetOrCompile(RequireAllTags, RequireAnyTags, RequireNoneTags);
+}
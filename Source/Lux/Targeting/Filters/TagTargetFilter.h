@@ -0,0 +1,61 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TargetFilter.h"
+#include "GameplayTagContainer.h"
+#include "System/GameplayTagStack.h"
+#include "TagTargetFilter.generated.h"
+
+/**
+ * 타겟이 보유한 게임플레이 태그를 기반으로 타겟을 필터링하는 필터입니다.
+ * 조건은 처음 사용할 때 한 번 컴파일되어, 타겟마다 워드 단위 비트 비교만 수행합니다.
+ * 컴파일된 질의가 낡지 않도록 조건은 에디터에서만 바꿀 수 있고 블루프린트에서는 읽기만 가능합니다.
+ */
+UCLASS(BlueprintType, EditInlineNew, meta = (DisplayName = "Tag Target Filter"))
+class LUX_API UTagTargetFilter : public UTargetFilter
+{
+	GENERATED_BODY()
+
+public:
+	UTagTargetFilter();
+
+	//~ UObject interface
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~ End UObject interface
+
+	//~ UTargetFilter interface
+	virtual bool IsTargetValid(AActor* Target, AActor* SourceActor) const override;
+	virtual FString GetFilterDescription() const override;
+	//~ End UTargetFilter interface
+
+protected:
+	/** 타겟이 모두 가지고 있어야 하는 태그입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tag Filter")
+	FGameplayTagContainer RequireAllTags;
+
+	/** 타겟이 이 중 하나 이상 가지고 있어야 하는 태그입니다. (비어 있으면 검사하지 않음) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tag Filter")
+	FGameplayTagContainer RequireAnyTags;
+
+	/** 타겟이 이 중 하나라도 가지고 있으면 제외됩니다. (예: 'State.Generic.Invulnerable') */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Tag Filter")
+	FGameplayTagContainer RequireNoneTags;
+
+	/** 타겟에 ActionSystemComponent 가 없는 경우 허용할지 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tag Filter")
+	bool bAllowTargetWithoutASC = false;
+
+	/** 디버그 정보를 로그로 출력할지 여부입니다. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tag Filter|Debug")
+	bool bDebugLog = false;
+
+private:
+	/** 조건을 컴파일한 질의를 반환합니다. (최초 호출 시 한 번만 컴파일됩니다.) */
+	const FLuxCompiledTagQuery& GetTagQuery() const;
+
+	FLuxCompiledTagQuery TagQuery;
+};
@@ -57,7 +57,7 @@ void UUW_ActionTooltip::InitializeTooltip(UActionSystemComponent* InASC, const F
 	ASC = InASC;
 
 	// 초기 툴팁 데이터 업데이트
-	UpdateTooltipText(ActionSpec);
+	UpdateTooltipText(ActionSpec.Action);
 }
 
 
@@ -69,14 +69,15 @@ void UUW_ActionTooltip::UpdateTooltipData()
 	}
 
 	// ActionSpecHandle을 사용하여 현재 ActionSpec 가져오기
-	const FLuxActionSpec* CurrentActionSpec = ASC->FindActionSpecFromHandle(ActionSpecHandle);
-	if (!CurrentActionSpec || !CurrentActionSpec->Action)
+	const FLuxActionSpecSnapshotPtr Snapshot = ASC->GetActionSpecSnapshot();
+	const FLuxActionSpecSnapshotEntry* CurrentActionSpec = Snapshot.IsValid() ? Snapshot->Find(ActionSpecHandle) : nullptr;
+	if (!CurrentActionSpec || !CurrentActionSpec->Action.IsValid())
 	{
 		return;
 	}
 
 	// LuxAction에서 직접 데이터를 가져와서 텍스트만 업데이트 (아이콘은 ActionIcon에서 전달)
-	UpdateTooltipText(*CurrentActionSpec);
+	UpdateTooltipText(CurrentActionSpec->Action.Get());
 }
 
 
@@ -284,14 +285,15 @@ float UUW_ActionTooltip::GetActionLevelData(const FString& DataName) const
 	}
 
 	// ActionSpecHandle을 사용하여 현재 ActionSpec 가져오기
-	const FLuxActionSpec* CurrentActionSpec = ASC->FindActionSpecFromHandle(ActionSpecHandle);
-	if (!CurrentActionSpec || !CurrentActionSpec->Action)
+	const FLuxActionSpecSnapshotPtr Snapshot = ASC->GetActionSpecSnapshot();
+	const FLuxActionSpecSnapshotEntry* CurrentActionSpec = Snapshot.IsValid() ? Snapshot->Find(ActionSpecHandle) : nullptr;
+	if (!CurrentActionSpec || !CurrentActionSpec->Action.IsValid())
 	{
 		UE_LOG(LogLux, Warning, TEXT("[%s] 액션 스펙이 유효하지 않습니다. 데이터: %s"), *GetNameSafe(this), *DataName);
 		return 0.0f;
 	}
 
-	ULuxAction* Action = CurrentActionSpec->Action;
+	ULuxAction* Action = CurrentActionSpec->Action.Get();
 
 	// 액션의 현재 레벨 가져오기
 	int32 ActionLevel = CurrentActionSpec->Level;
@@ -390,16 +392,14 @@ float UUW_ActionTooltip::ExtractValueFromInstancedStruct(const FInstancedStruct&
 	}
 }
 
-void UUW_ActionTooltip::UpdateTooltipText(const FLuxActionSpec& ActionSpec)
+void UUW_ActionTooltip::UpdateTooltipText(ULuxAction* Action)
 {
-	if (!ASC.IsValid() || !ActionSpec.Action)
+	if (!ASC.IsValid() || !Action)
 	{
 		UE_LOG(LogLux, Error, TEXT("[%s] ASC 또는 ActionSpec.Action이 유효하지 않습니다."), *GetNameSafe(this));
 		return;
 	}
 
-	ULuxAction* Action = ActionSpec.Action;
-
 	// 액션 이름 설정
 	if (TextActionName)
 	{
@@ -64,7 +64,7 @@ protected:
     float ExtractValueFromInstancedStruct(const FInstancedStruct& InstancedStruct, const FString& FieldName) const;
 
     /** 아이콘을 제외한 텍스트 정보만 업데이트합니다. */
-    void UpdateTooltipText(const FLuxActionSpec& ActionSpec);
+    void UpdateTooltipText(ULuxAction* Action);
 
     /** 아이콘만 업데이트합니다. */
     void UpdateTooltipIcon(UTexture2D* IconTexture);